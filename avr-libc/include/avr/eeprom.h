@@ -54,7 +54,8 @@
     AVR microcontrollers.  The implementation uses a simple polled
     mode interface.  Applications that require interrupt-controlled
     EEPROM access to ensure that no time will be wasted in spinloops
-    will have to deploy their own implementation.
+    can queue their writes with eeprom_write_async(), or deploy their
+    own implementation.
 
     \par Notes:
 
@@ -77,11 +78,16 @@
     proper protection (e.g. by disabling interrupts before accessing
     them).
 
-    - All write functions force erase_and_write programming mode.
+    - On devices with the EEPM bits, the write and update functions
+    choose the programming mode after the old value: erase only when
+    the new value is 0xFF, write only when no bit goes from 0 to 1,
+    erase and write otherwise.  The first two take about half of the
+    time.
     
     - For Xmega the EEPROM start address is 0, like other architectures.
     The reading functions add the 0x2000 value to use EEPROM mapping into
-    data space.
+    data space.  The block write and update functions load the page
+    buffer with the bytes of a page, and program each page once.
  */
 
 #ifdef __cplusplus
@@ -207,6 +213,95 @@ void eeprom_update_float (float *__p, float __value);
  */
 void eeprom_update_block (const void *__src, void *__dst, size_t __n);
 
+#if	defined (__DOXYGEN__) || !(defined (__AVR_XMEGA__) && __AVR_XMEGA__)
+
+/** \ingroup avr_eeprom
+    Queue a block of \a __n bytes to be written to EEPROM address \a __dst
+    from \a __src, and return at once.  The bytes are written in the
+    background, one per EEPROM ready interrupt, skipping those which
+    already hold their value like eeprom_update_block().  When the
+    block is written, \a __done is called from the interrupt, unless
+    it is null.
+
+    Up to 4 blocks may be pending.  The data at \a __src must not
+    change before its block is done.  Global interrupts must be enabled,
+    and the other EEPROM functions must not be used while
+    eeprom_async_busy() is not zero.
+
+    \returns 0, or -1 if the queue is full.
+    \note Not available on XMEGA devices.
+ */
+int eeprom_write_async (const void *__src, void *__dst, size_t __n,
+			void (*__done) (void));
+
+/** \ingroup avr_eeprom
+    \returns the number of blocks queued by eeprom_write_async() and not
+    yet written, 0 when the EEPROM is free again.
+ */
+uint8_t eeprom_async_busy (void);
+
+#endif
+
+/** \name Wear leveling ring of records	*/
+/*@{*/
+
+/** \struct eeprom_ring
+    \ingroup avr_eeprom
+    A ring of \c slots records of \c size bytes in EEPROM, for a value
+    written often: each write goes to the next slot, so the wear is
+    spread over all of them.  The fields are set by eeprom_ring_init().
+ */
+struct eeprom_ring {
+    void *base;			/**< EEPROM address of the ring */
+    uint8_t size;		/**< bytes of data in a record */
+    uint8_t slots;		/**< number of records */
+    uint8_t newest;		/**< slot of the newest record */
+    uint16_t seq;		/**< sequence number of the newest record */
+};
+
+/** \def EEPROM_RING_SLOT
+    \ingroup avr_eeprom
+    Bytes of EEPROM taken by a record of \a size bytes of data: the
+    data, a 16-bit sequence number and a 16-bit CRC.	*/
+#define EEPROM_RING_SLOT(size)	((size) + 4)
+
+/** \def EEPROM_RING_SIZE
+    \ingroup avr_eeprom
+    Bytes of EEPROM taken by a ring of \a slots records of \a size
+    bytes, e.g.
+    \code uint8_t odometer[EEPROM_RING_SIZE (sizeof (uint32_t), 32)] EEMEM; \endcode */
+#define EEPROM_RING_SIZE(size, slots)	(EEPROM_RING_SLOT (size) * (slots))
+
+/** \def EEPROM_RING_NONE
+    \ingroup avr_eeprom
+    The value of eeprom_ring::newest when the ring holds no record.	*/
+#define EEPROM_RING_NONE	0xFF
+
+/** \ingroup avr_eeprom
+    Set up \a __r for the ring of \a __slots records of \a __size bytes
+    at EEPROM address \a __base, and find its newest record.  This reads
+    the sequence numbers of about log2(\a __slots) slots, and the newest
+    record to check its CRC.  A record whose write was cut off fails the
+    check, and the one before it is taken instead, which needs at least
+    2 slots.
+    \returns 1 if a record was found, 0 if the ring is empty.
+ */
+int eeprom_ring_init (struct eeprom_ring *__r, void *__base, uint8_t __size,
+		      uint8_t __slots);
+
+/** \ingroup avr_eeprom
+    Read the data of the newest record of \a __r to \a __dst.
+    \returns 0, or -1 if the ring is empty.
+ */
+int eeprom_ring_read (const struct eeprom_ring *__r, void *__dst);
+
+/** \ingroup avr_eeprom
+    Write \a __src as the new record of \a __r, to the slot after the
+    newest one, with eeprom_update_block().
+ */
+void eeprom_ring_write (struct eeprom_ring *__r, const void *__src);
+
+/*@}*/
 
 /** \name IAR C compatibility defines	*/
 /*@{*/
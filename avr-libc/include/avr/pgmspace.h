@@ -1059,6 +1059,133 @@ not interfere with data accesses.
 	tmp;                                              \
 })
 
+/** \ingroup avr_pgmspace
+    \struct pgm_cursor_t
+    A read position in program memory for sequential access, see
+    pgm_cursor_init().  It holds a far address (24 bits), so one cursor
+    can walk tables anywhere in the flash, across 64 KB boundaries.
+
+    \note When the cursor is a local variable, the compiler can keep its
+    address in the Z register (and RAMPZ) between the reads, so a read
+    costs little more than one LPM or ELPM instruction. */
+
+typedef struct {
+    uint16_t __lo;	/* bits 15..0, Z	*/
+    uint8_t __hh;	/* bits 23..16, RAMPZ	*/
+} pgm_cursor_t;
+
+/** \ingroup avr_pgmspace
+    Set the cursor \p __c to the far flash address \p __addr, as given
+    by pgm_get_far_address(), or to a near address casted to
+    uint_farptr_t.	*/
+
+static __inline__ void
+pgm_cursor_init (pgm_cursor_t *__c, uint_farptr_t __addr)
+{
+    __c->__lo = (uint16_t) __addr;
+    __c->__hh = (uint8_t) (__addr >> 16);
+}
+
+/** \ingroup avr_pgmspace
+    Return the far flash address of the next byte to be read with the
+    cursor \p __c.	*/
+
+static __inline__ uint_farptr_t
+pgm_cursor_tell (const pgm_cursor_t *__c)
+{
+    return ((uint_farptr_t) __c->__hh << 16) | __c->__lo;
+}
+
+#if !defined(__DOXYGEN__)
+
+/* The load instruction(s) for one byte: %[r] = [RAMPZ:]Z, advance
+   [RAMPZ:]Z by 1.  The classic ELPM does not increment, so there %[h]
+   is advanced and written to RAMPZ for each byte.  Devices without
+   ELPM, even those with a RAMPZ register, use LPM and ignore %[h].	*/
+#if defined(__AVR_HAVE_ELPMX__)
+# define __PGM_CURSOR_LD(r)	"elpm " r ", Z+"		"\n\t"
+#elif defined(__AVR_HAVE_ELPM__)
+# define __PGM_CURSOR_LD(r)	"out %[rampz], %[h]"		"\n\t" \
+				"elpm"				"\n\t" \
+				"mov " r ", __tmp_reg__"	"\n\t" \
+				"adiw r30, 1"			"\n\t" \
+				"adc %[h], __zero_reg__"	"\n\t"
+#elif defined(__AVR_HAVE_LPMX__)
+# define __PGM_CURSOR_LD(r)	"lpm " r ", Z+"			"\n\t"
+#else
+# define __PGM_CURSOR_LD(r)	"lpm"				"\n\t" \
+				"mov " r ", __tmp_reg__"	"\n\t" \
+				"adiw r30, 1"			"\n\t"
+#endif
+
+/* Load RAMPZ before the ELPM Z+ reads, take %[h] back after them.
+   Devices with RAMPD use RAMPZ for the data space too, so the value
+   of RAMPZ is saved in r0 and restored.	*/
+#if defined(__AVR_HAVE_ELPMX__) && defined(__AVR_HAVE_RAMPD__)
+# define __PGM_CURSOR_BEG	"in __tmp_reg__, %[rampz]"	"\n\t" \
+				"push __tmp_reg__"		"\n\t" \
+				"out %[rampz], %[h]"		"\n\t"
+# define __PGM_CURSOR_END	"in %[h], %[rampz]"		"\n\t" \
+				"pop __tmp_reg__"		"\n\t" \
+				"out %[rampz], __tmp_reg__"	"\n\t"
+#elif defined(__AVR_HAVE_ELPMX__)
+# define __PGM_CURSOR_BEG	"out %[rampz], %[h]"		"\n\t"
+# define __PGM_CURSOR_END	"in %[h], %[rampz]"		"\n\t"
+#else
+# define __PGM_CURSOR_BEG	""
+# define __PGM_CURSOR_END	""
+#endif
+
+#if defined(__AVR_HAVE_ELPM__)
+# define __PGM_CURSOR_RAMPZ	[rampz] "I" (_SFR_IO_ADDR(RAMPZ))
+#else
+# define __PGM_CURSOR_RAMPZ	[rampz] "n" (0)
+#endif
+
+#endif	/* !__DOXYGEN__ */
+
+/** \ingroup avr_pgmspace
+    Read the next byte of program memory with the cursor \p __c and
+    advance the cursor.	*/
+
+static __inline__ uint8_t
+pgm_cursor_getc (pgm_cursor_t *__c)
+{
+    uint8_t __r;
+    __asm__ __volatile__ (
+	__PGM_CURSOR_BEG
+	__PGM_CURSOR_LD ("%[r]")
+	__PGM_CURSOR_END
+	: [r] "=r" (__r), "+z" (__c->__lo), [h] "+r" (__c->__hh)
+	: __PGM_CURSOR_RAMPZ
+    );
+    return __r;
+}
+
+/** \ingroup avr_pgmspace
+    Copy the next \p __n bytes of program memory to \p __buf with the
+    cursor \p __c and advance the cursor.	*/
+
+static __inline__ void
+pgm_cursor_read (pgm_cursor_t *__c, void *__buf, size_t __n)
+{
+    if (__n) {
+	__asm__ __volatile__ (
+	    __PGM_CURSOR_BEG
+	    "1:"				"\n\t"
+	    __PGM_CURSOR_LD ("__tmp_reg__")
+	    "st X+, __tmp_reg__"		"\n\t"
+	    "sbiw %[n], 1"			"\n\t"
+	    "brne 1b"				"\n\t"
+	    __PGM_CURSOR_END
+	    : "+z" (__c->__lo), [h] "+r" (__c->__hh),
+	      "+x" (__buf), [n] "+w" (__n)
+	    : __PGM_CURSOR_RAMPZ
+	    : "memory"
+	);
+    }
+}
+
 
 
 extern const void * memchr_P(const void *, int __val, size_t __len) __ATTR_CONST__;
@@ -1106,6 +1233,43 @@ extern int strncasecmp_PF (const char *s1, uint_farptr_t s2, size_t n) __ATTR_PU
 extern char *strstr_PF (const char *s1, uint_farptr_t s2);
 extern size_t strlcpy_PF (char *dst, uint_farptr_t src, size_t siz);
 extern int memcmp_PF(const void *, uint_farptr_t, size_t) __ATTR_PURE__;
+extern uint_farptr_t memchr_PF(uint_farptr_t, int __val, size_t __len) __ATTR_CONST__;
+extern uint_farptr_t memrchr_PF(uint_farptr_t, int __val, size_t __len) __ATTR_CONST__;
+extern void *memccpy_PF(void *, uint_farptr_t, int __val, size_t);
+extern void *memmem_PF(const void *, size_t, uint_farptr_t, size_t) __ATTR_PURE__;
+extern uint_farptr_t strchr_PF(uint_farptr_t, int __val) __ATTR_CONST__;
+extern uint_farptr_t strrchr_PF(uint_farptr_t, int __val) __ATTR_CONST__;
+extern size_t strspn_PF(const char *__s, uint_farptr_t __accept) __ATTR_PURE__;
+extern size_t strcspn_PF(const char *__s, uint_farptr_t __reject) __ATTR_PURE__;
+extern char *strpbrk_PF(const char *__s, uint_farptr_t __accept) __ATTR_PURE__;
+extern char *strsep_PF(char **__sp, uint_farptr_t __delim);
+extern char *strtok_PF(char *__s, uint_farptr_t __delim);
+extern char *strtok_rPF(char *__s, uint_farptr_t __delim, char **__last);
+
+extern const void *bsearch_P(const void *__key, const void *__base,
+			     size_t __nmemb, size_t __size,
+			     int (*__compar)(const void *, const void *));
+extern uint_farptr_t bsearch_PF(const void *__key, uint_farptr_t __base,
+				size_t __nmemb, size_t __size,
+				int (*__compar)(const void *, uint_farptr_t));
+extern size_t isearch_u16_P(uint16_t __key, const uint16_t *__table,
+			    size_t __nmemb) __ATTR_PURE__;
+extern size_t isearch_u32_P(uint32_t __key, const uint32_t *__table,
+			    size_t __nmemb) __ATTR_PURE__;
+extern size_t isearch_u16_PF(uint16_t __key, uint_farptr_t __table,
+			     size_t __nmemb) __ATTR_PURE__;
+extern size_t isearch_u32_PF(uint32_t __key, uint_farptr_t __table,
+			     size_t __nmemb) __ATTR_PURE__;
+
+#ifdef __MEMX
+extern size_t strlen_X(const __memx char *) __ATTR_PURE__;
+extern void *memcpy_X(void *, const __memx void *, size_t);
+extern char *strcpy_X(char *, const __memx char *);
+extern int strcmp_X(const char *, const __memx char *) __ATTR_PURE__;
+extern int strncmp_X(const char *, const __memx char *, size_t) __ATTR_PURE__;
+extern int memcmp_X(const void *, const __memx void *, size_t) __ATTR_PURE__;
+extern const __memx char *strchr_X(const __memx char *, int __val) __ATTR_PURE__;
+#endif
 
 
 __attribute__((__always_inline__)) static __inline__ size_t strlen_P(const char * s);
@@ -1114,6 +1278,61 @@ static __inline__ size_t strlen_P(const char *s) {
      ? __builtin_strlen(s) : __strlen_P(s);
 } 
 
+#if defined(__OPTIMIZE__) && !defined(__cplusplus) && !defined(__AVR_TINY__)
+
+/* memcpy_P() and memcmp_P() of a constant size of up to 8 bytes are
+   expanded inline, reading the flash with LPM Z+.	*/
+
+#if defined(__AVR_HAVE_LPMX__)
+# define __LPM_inc(c, z)				\
+    __asm__ ("lpm %0, Z+" : "=r" (c), "+z" (z))
+#else
+# define __LPM_inc(c, z)				\
+    __asm__ ("lpm" "\n\t"					\
+	     "mov %0, r0" "\n\t"				\
+	     "adiw r30, 1"					\
+	     : "=r" (c), "+z" (z) : : "r0")
+#endif
+
+__attribute__((__always_inline__)) static __inline__ void *
+__memcpy_P_inline (void *__d, const void *__s, size_t __n)
+{
+    unsigned char *__p = (unsigned char *) __d;
+    for (; __n; __n--) {
+	unsigned char __c;
+	__LPM_inc (__c, __s);
+	*__p++ = __c;
+    }
+    return __d;
+}
+
+__attribute__((__always_inline__)) static __inline__ int
+__memcmp_P_inline (const void *__s1, const void *__s2, size_t __n)
+{
+    const unsigned char *__p = (const unsigned char *) __s1;
+    for (; __n; __n--) {
+	unsigned char __c;
+	int __d;
+	__LPM_inc (__c, __s2);
+	__d = *__p++ - __c;
+	if (__d)
+	    return __d;
+    }
+    return 0;
+}
+
+#define memcpy_P(__d, __s, __n)					\
+    (__builtin_constant_p (__n) && (__n) <= 8			\
+     ? __memcpy_P_inline ((__d), (__s), (__n))			\
+     : memcpy_P ((__d), (__s), (__n)))
+
+#define memcmp_P(__s1, __s2, __n)				\
+    (__builtin_constant_p (__n) && (__n) <= 8			\
+     ? __memcmp_P_inline ((__s1), (__s2), (__n))		\
+     : memcmp_P ((__s1), (__s2), (__n)))
+
+#endif	/* __OPTIMIZE__ && !__cplusplus && !__AVR_TINY__ */
+
 
 
 #ifdef __cplusplus
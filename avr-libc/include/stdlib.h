@@ -179,6 +179,12 @@ extern ldiv_t ldiv(long __num, long __denom) __asm__("__divmodsi4") __ATTR_CONST
      The comparison function must return an integer less than, equal
      to, or greater than zero if the first argument is considered to
      be respectively less than, equal to, or greater than the second.
+
+     The sort is not recursive: it keeps pending partitions in a
+     fixed stack of less than 100 bytes, and switches to heapsort
+     when partitioning degrades, so that it never takes more than
+     O(n log n) time.  Objects of 2 and 4 bytes are swapped a word
+     at a time.
 */
 extern void qsort(void *__base, size_t __nmemb, size_t __size,
 		  __compar_fn_t __compar);
@@ -590,6 +596,94 @@ extern void srandom(unsigned long __seed);
    so the function becomes re-entrant.
 */
 extern long random_r(unsigned long *__ctx);
+
+/**
+ \ingroup avr_stdlib
+   The random16() and random32() functions return pseudo-random
+   numbers from Marsaglia's xorshift generators, in the full range of
+   16 and 32 bits, with periods of 2**16 - 1 and 2**32 - 1.
+
+   They take a few dozen cycles per number, as they shift and XOR
+   only, while rand() and random() need a 32-bit division.  The
+   numbers are good enough for jitter, backoff or dithering, but not
+   for statistics, and of course not for cryptography.
+
+   srandom16() and srandom32() set the seed of the sequences.  A seed
+   of 0 is replaced with a fixed nonzero value.
+*/
+extern unsigned int random16(void);
+/**
+ \ingroup avr_stdlib
+   Seed random16(); see there.
+*/
+extern void srandom16(unsigned int __seed);
+/**
+ \ingroup avr_stdlib
+   Variant of random16() that keeps its state in \c *ctx.
+*/
+extern unsigned int random16_r(unsigned int *__ctx);
+/**
+ \ingroup avr_stdlib
+   32-bit pseudo-random numbers; see random16().
+*/
+extern unsigned long random32(void);
+/**
+ \ingroup avr_stdlib
+   Seed random32() and random_fill(); see random16().
+*/
+extern void srandom32(unsigned long __seed);
+/**
+ \ingroup avr_stdlib
+   Variant of random32() that keeps its state in \c *ctx.
+*/
+extern unsigned long random32_r(unsigned long *__ctx);
+/**
+ \ingroup avr_stdlib
+   Fill \c n bytes at \c buf with pseudo-random numbers: the bytes of
+   the numbers random32() would return, least significant first.  The
+   sequence is shared with random32().
+*/
+extern void random_fill(void *__buf, size_t __n);
+/**
+ \ingroup avr_stdlib
+   Variant of random_fill() that keeps its state in \c *ctx, like
+   random32_r().
+*/
+extern void random_fill_r(void *__buf, size_t __n, unsigned long *__ctx);
+
+/**
+ \ingroup avr_stdlib
+   The radixsort_u8(), radixsort_u16() and radixsort_u32() functions
+   sort an array of \c nmemb unsigned 8, 16 or 32-bit keys at \c base
+   in ascending order.
+
+   They do not compare keys but distribute them by 4-bit digits,
+   starting with the least significant one, which on the AVR is
+   several times faster than qsort() for integer keys.  Digits which
+   are the same in all keys are skipped, so that, for example, 10-bit
+   ADC samples take three passes.  The sort is stable.
+
+   If \c data is not NULL, it is an array of \c nmemb 16-bit values,
+   such as indices or pointers, which is reordered along with the
+   keys.
+
+   \c tmp is scratch memory for \c nmemb keys, plus \c nmemb
+   16-bit values if \c data is used.
+*/
+extern void radixsort_u8(unsigned char *__base, size_t __nmemb, void *__tmp,
+			 unsigned int *__data);
+/**
+ \ingroup avr_stdlib
+   Sort 16-bit keys; see radixsort_u8().
+*/
+extern void radixsort_u16(unsigned int *__base, size_t __nmemb, void *__tmp,
+			  unsigned int *__data);
+/**
+ \ingroup avr_stdlib
+   Sort 32-bit keys; see radixsort_u8().
+*/
+extern void radixsort_u32(unsigned long *__base, size_t __nmemb, void *__tmp,
+			  unsigned int *__data);
 #endif /* __ASSEMBLER */
 /*@}*/
 
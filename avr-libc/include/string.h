@@ -64,7 +64,21 @@ extern "C" {
     strings. 
 
     \note If the strings you are working on resident in program space (flash),
-    you will need to use the string functions described in \ref avr_pgmspace. */
+    you will need to use the string functions described in \ref avr_pgmspace.
+
+    \note The default memcpy(), memmove() and memset() are optimized for
+    size.  Versions unrolled for speed, which take roughly half the cycles
+    on large blocks in exchange for about 30 extra words each, are in
+    \c libc_fast.a.  Link them in with:
+
+    \code
+    -lc_fast
+    \endcode
+
+    \note With optimization on, memcmp() of a constant size of up to 8
+    bytes is expanded inline, as are memcpy() and memset() by the
+    compiler itself.
+*/
 
 
 /** \ingroup avr_string
@@ -147,6 +161,32 @@ extern char *strtok(char *, const char *);
 extern char *strtok_r(char *, const char *, char **);
 extern char *strupr(char *);
 
+#if defined(__OPTIMIZE__) && !defined(__cplusplus) && !defined(__DOXYGEN__)
+
+/* memcmp() of a few bytes with a constant size is expanded inline.
+   memcpy() and memset() need no such help: GCC expands them inline by
+   itself for small constant sizes.	*/
+
+__attribute__((__always_inline__)) static __inline__ int
+__memcmp_inline (const void *__s1, const void *__s2, size_t __n)
+{
+    const unsigned char *__p = (const unsigned char *) __s1;
+    const unsigned char *__q = (const unsigned char *) __s2;
+    for (; __n; __n--) {
+	int __d = *__p++ - *__q++;
+	if (__d)
+	    return __d;
+    }
+    return 0;
+}
+
+#define memcmp(__s1, __s2, __n)					\
+    (__builtin_constant_p (__n) && (__n) <= 8			\
+     ? __memcmp_inline ((__s1), (__s2), (__n))			\
+     : memcmp ((__s1), (__s2), (__n)))
+
+#endif	/* __OPTIMIZE__ && !__cplusplus */
+
 #if 1 /* ??? unimplemented */
 extern int strcoll(const char *s1, const char *s2);
 extern char *strerror(int errnum);
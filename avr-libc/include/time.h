@@ -222,6 +222,20 @@ extern          "C" {
     */
     void            localtime_r(const time_t * timer, struct tm * timeptr);
 
+    /**
+        Return the current local time, as localtime() of time() would, in constant time.
+
+        The first call breaks down the system time. From then on system_tick() advances
+        this broken-down time by one second, carrying into minutes, hours, days, months
+        and years, so later calls merely copy it. Calling set_system_time(), set_zone()
+        or set_dst() causes the next call to break down the system time again. If a
+        Daylight Saving function is set, this also happens each quarter hour, when
+        Daylight Saving may begin or end.
+
+        The result is stored in the same static struct as that of localtime() and gmtime().
+    */
+    struct tm      *localtime_now(void);
+
     /**
     The asctime function converts the broken-down time of timeptr, into an ascii string in the form
 
@@ -264,6 +278,19 @@ extern          "C" {
     */
     size_t          strftime(char *s, size_t maxsize, const char *format, const struct tm * timeptr);
 
+    /**
+        strftime() with the format in program space.
+    */
+    size_t          strftime_P(char *s, size_t maxsize, const char *format, const struct tm * timeptr);
+
+    struct __file;
+
+    /**
+        Like strftime(), but the result is written to a stream, there is no limit to its length.
+        Returns the number of characters written.
+    */
+    size_t          fstrftime(struct __file * stream, const char *format, const struct tm * timeptr);
+
     /**
         Specify the Daylight Saving function.
 
@@ -277,6 +304,9 @@ extern          "C" {
             \code #include <util/usa_dst.h>\endcode
             for the United States
 
+        These evaluate their rules on every call. set_dst_rules() installs rule_dst(), which
+        caches the transitions of the year instead.
+
         If a Daylight Saving function is not specified, the system will ignore Daylight Saving.
     */
     void            set_dst(int (*) (const time_t *, int32_t *));
@@ -334,6 +364,29 @@ extern          "C" {
     */
     void            system_tick(void);
 
+    /**
+        Maintain a monotonic tick count by calling this function at a fixed rate, 1 kHz for
+        clock_ms() to count milliseconds. Like system_tick(), it may be called from a 'Naked'
+        ISR. Unlike system_tick(), it does not disable interrupts, so it must not be called
+        from more than one context.
+    */
+    void            clock_tick(void);
+
+    /**
+        Return the low 32 bits of the tick count. When clock_tick() is called at 1 kHz this
+        is the time in milliseconds since start up, which wraps after 49.7 days.
+
+        The count is read without disabling interrupts: the read is repeated if a tick
+        happened in the middle of it.
+    */
+    uint32_t        clock_ms(void);
+
+    /**
+        Return the 64 bit tick count, which does not wrap. Like clock_ms(), it is read
+        without disabling interrupts.
+    */
+    uint64_t        clock_ticks64(void);
+
     /**
         Enumerated labels for the days of the week.
     */
@@ -365,6 +418,51 @@ extern          "C" {
         DECEMBER
     };
 
+    /**
+        A Daylight Saving transition: a day of week in a week of a month, at an hour of local
+        standard time.
+    */
+    struct dst_rule {
+        uint8_t         month;  /**< JANUARY to DECEMBER */
+        uint8_t         week;   /**< 1 to 4 for the first to fourth, 5 for the last such day */
+        uint8_t         wday;   /**< SUNDAY to SATURDAY */
+        uint8_t         hour;   /**< hour of local standard time */
+    };
+
+    /**
+        The Daylight Saving rules of a time zone: when Daylight Saving starts and ends, and
+        by how many seconds it advances the time. Examples, for Central Europe:
+        \code
+        static const struct dst_rules cet = {
+            { MARCH, 5, SUNDAY, 2 }, { OCTOBER, 5, SUNDAY, 2 }, ONE_HOUR
+        };
+        \endcode
+        and for the United States:
+        \code
+        static const struct dst_rules usa = {
+            { MARCH, 2, SUNDAY, 2 }, { NOVEMBER, 1, SUNDAY, 1 }, ONE_HOUR
+        };
+        \endcode
+        In the southern hemisphere the end comes before the start in the year.
+    */
+    struct dst_rules {
+        struct dst_rule start;
+        struct dst_rule end;
+        int16_t         offset;
+    };
+
+    /**
+        A Daylight Saving function for set_dst(), which follows the rules given to
+        set_dst_rules(). It computes the transitions of a year once, then returns the cached
+        result for as long as the time stamp stays between the same two transitions.
+    */
+    int             rule_dst(const time_t * timer, int32_t * z);
+
+    /**
+        Copy the Daylight Saving rules, and select rule_dst() as the Daylight Saving function.
+    */
+    void            set_dst_rules(const struct dst_rules * rules);
+
     /**
         Return 1 if year is a leap year, zero if it is not.
     */
@@ -496,6 +594,38 @@ extern          "C" {
     /** Returns the declination of the sun in radians. */
     double          solar_declination(const time_t * timer);
 
+    /**
+        The solar ephemeris of a day, at the location of the observer. See ephemeris_r().
+    */
+    struct ephemeris {
+        uint16_t        day;            /**< days since the epoch plus 1, 0 before the first use */
+        int32_t         latitude;       /**< position of the observer */
+        int32_t         longitude;
+        double          declination;    /**< as by solar_declination() */
+        int16_t         equation;       /**< as by equation_of_time() */
+        int32_t         daylight;       /**< as by daylight_seconds() */
+        time_t          noon;           /**< as by solar_noon() */
+        time_t          rise;           /**< as by sun_rise() */
+        time_t          set;            /**< as by sun_set() */
+    };
+
+    /**
+        Fill eph with the values the functions above return at noon UTC of the day of timer,
+        for the position set by set_position(). They are computed together, sharing the
+        orbital position of the Earth, and only when the day or the position changed since the
+        last call with eph. eph must be zeroed before its first use.
+
+        Repeated queries, for example once a minute, then cost a comparison:
+        \code
+        static struct ephemeris eph;
+        time_t now = time(NULL);
+
+        ephemeris_r(&now, &eph);
+        light = (now < eph.rise || now >= eph.set);
+        \endcode
+    */
+    void            ephemeris_r(const time_t * timer, struct ephemeris * eph);
+
     /**
         Returns an approximation to the phase of the moon.
         The sign of the returned value indicates a waning or waxing phase.
@@ -0,0 +1,180 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE. */
+
+/* $Id$ */
+
+#ifndef _UTIL_DIVMOD_H_
+#define _UTIL_DIVMOD_H_
+
+#include <stdint.h>
+
+/** \file */
+/** \defgroup util_divmod <util/divmod.h>: Division by constants
+    \code #include <util/divmod.h> \endcode
+
+    This header file provides the quotient and the remainder of an
+    unsigned division by a constant divisor, such as 10, 60 or 24.
+
+    The generic division (div(), ldiv() or the '/' and '%' operators
+    on \c long operands) shifts and subtracts once per bit of the
+    dividend, so a 32-bit division costs several hundred cycles.  The
+    functions here multiply the dividend by a reciprocal of the divisor
+    instead, which the compiler computes at compile time, and then
+    correct the estimate with a remainder check.  On devices without a
+    hardware multiplier the generic division is used.
+
+    The divisor \a d of the udivmod8_const(), udivmod16_const() and
+    udivmod32_const() macros must be an integer constant expression:
+    \c 2 ... \c 255, \c 2 ... \c 65535 and \c 2 ... \c 4194303
+    respectively.
+
+    \code
+    udiv16_t t = udivmod16_60 (minutes);
+    hours = t.quot;
+    minutes = t.rem;
+    \endcode
+*/
+
+/** \ingroup util_divmod
+    Result type of an 8-bit division. */
+typedef struct {
+    uint8_t quot;		/**< The Quotient. */
+    uint8_t rem;		/**< The Remainder. */
+} udiv8_t;
+
+/** \ingroup util_divmod
+    Result type of a 16-bit division. */
+typedef struct {
+    uint16_t quot;		/**< The Quotient. */
+    uint16_t rem;		/**< The Remainder. */
+} udiv16_t;
+
+/** \ingroup util_divmod
+    Result type of a 32-bit division. */
+typedef struct {
+    uint32_t quot;		/**< The Quotient. */
+    uint32_t rem;		/**< The Remainder. */
+} udiv32_t;
+
+#ifndef __DOXYGEN__
+
+#if defined(__AVR_TINY__) || !defined(__AVR__)
+
+static __inline__ udiv8_t
+__udivmodqi_const (uint8_t __n, uint8_t __m, uint8_t __d)
+{
+    udiv8_t __r;
+    (void) __m;
+    __r.quot = __n / __d;
+    __r.rem = __n % __d;
+    return __r;
+}
+
+static __inline__ udiv16_t
+__udivmodhi_const (uint16_t __n, uint16_t __m, uint16_t __d)
+{
+    udiv16_t __r;
+    (void) __m;
+    __r.quot = __n / __d;
+    __r.rem = __n % __d;
+    return __r;
+}
+
+static __inline__ udiv32_t
+__udivmodsi_const (uint32_t __n, uint32_t __m, uint32_t __d)
+{
+    udiv32_t __r;
+    (void) __m;
+    __r.quot = __n / __d;
+    __r.rem = __n % __d;
+    return __r;
+}
+
+#else
+
+extern udiv8_t __udivmodqi_const (uint8_t __n, uint8_t __m, uint8_t __d)
+    __attribute__((__const__));
+extern udiv16_t __udivmodhi_const (uint16_t __n, uint16_t __m, uint16_t __d)
+    __attribute__((__const__));
+extern udiv32_t __udivmodsi_const (uint32_t __n, uint32_t __m, uint32_t __d)
+    __attribute__((__const__));
+
+#endif
+
+#endif	/* !__DOXYGEN__ */
+
+/** \ingroup util_divmod
+    \def udivmod8_const
+    Divide the 8-bit \a n by the constant \a d. */
+#define udivmod8_const(n, d)	\
+    __udivmodqi_const ((n), (uint8_t)(256U / (d)), (d))
+
+/** \ingroup util_divmod
+    \def udivmod16_const
+    Divide the 16-bit \a n by the constant \a d. */
+#define udivmod16_const(n, d)	\
+    __udivmodhi_const ((n), (uint16_t)(65536UL / (d)), (d))
+
+/** \ingroup util_divmod
+    \def udivmod32_const
+    Divide the 32-bit \a n by the constant \a d. */
+#define udivmod32_const(n, d)	\
+    __udivmodsi_const ((n), (uint32_t)(4294967296ULL / (d)), (d))
+
+/** \ingroup util_divmod
+    \name Common divisors
+    Shorthands for the divisors that are often used in decimal and
+    calendar conversions: \c udivmodW_D(n) divides the \c W bit \a n by
+    \c D.  */
+/**@{*/
+#define udivmod8_7(n)		udivmod8_const ((n), 7)
+#define udivmod8_10(n)		udivmod8_const ((n), 10)
+#define udivmod8_12(n)		udivmod8_const ((n), 12)
+#define udivmod8_24(n)		udivmod8_const ((n), 24)
+#define udivmod8_60(n)		udivmod8_const ((n), 60)
+#define udivmod8_100(n)		udivmod8_const ((n), 100)
+
+#define udivmod16_7(n)		udivmod16_const ((n), 7)
+#define udivmod16_10(n)		udivmod16_const ((n), 10)
+#define udivmod16_24(n)		udivmod16_const ((n), 24)
+#define udivmod16_60(n)		udivmod16_const ((n), 60)
+#define udivmod16_100(n)	udivmod16_const ((n), 100)
+#define udivmod16_365(n)	udivmod16_const ((n), 365)
+#define udivmod16_1461(n)	udivmod16_const ((n), 1461)
+#define udivmod16_36525(n)	udivmod16_const ((n), 36525)
+
+#define udivmod32_7(n)		udivmod32_const ((n), 7)
+#define udivmod32_10(n)		udivmod32_const ((n), 10)
+#define udivmod32_24(n)		udivmod32_const ((n), 24)
+#define udivmod32_60(n)		udivmod32_const ((n), 60)
+#define udivmod32_100(n)	udivmod32_const ((n), 100)
+#define udivmod32_3600(n)	udivmod32_const ((n), 3600)
+#define udivmod32_86400(n)	udivmod32_const ((n), 86400)
+/**@}*/
+
+#endif /* _UTIL_DIVMOD_H_ */
@@ -0,0 +1,207 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE. */
+
+/* $Id$ */
+
+#ifndef _UTIL_SORT_H_
+#define _UTIL_SORT_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/** \file */
+/** \defgroup util_sort <util/sort.h>: Type-specific sort and search
+    \code #include <util/sort.h> \endcode
+
+    qsort() and bsearch() work on any element type, so they call the
+    comparison function through a pointer for every comparison.  On
+    the AVR that call, with its argument setup and the saving of the
+    call-used registers, costs much more than comparing two integers.
+
+    The macros here generate a sort or a search function for one
+    element type, with the comparison expanded inline.  The comparison
+    \a less is a function or a function-like macro which is called
+    with two values of the element type and yields nonzero if the
+    first one orders before the second.
+
+    \code
+    #define u16_less(a, b)	((a) < (b))
+    SORT_DEFINE (sort_u16, uint16_t, u16_less)
+    BSEARCH_DEFINE (find_u16, uint16_t, u16_less)
+
+    sort_u16 (samples, n);
+    p = find_u16 (1000, samples, n);
+    \endcode
+
+    The generated functions are \c static.  Each SORT_DEFINE() costs
+    some hundred bytes of flash, so a type that is sorted in several
+    modules is best given one wrapper function.
+*/
+
+/** \ingroup util_sort
+    \def SORT_DEFINE
+    Define <tt>static void name (type *base, size_t nmemb)</tt>, which
+    sorts \a nmemb elements at \a base in ascending order of \a less.
+
+    The algorithm is the one of qsort(): an introsort without
+    recursion, which needs a fixed stack and never takes more than
+    O(n log n) time.  The sort is not stable.  */
+#define SORT_DEFINE(name, type, less)					\
+static void								\
+name (type *__base, size_t __nmemb)					\
+{									\
+    struct {								\
+	type *__lo;							\
+	size_t __n;							\
+	uint8_t __depth;						\
+    } __stack[8 * sizeof (size_t)], *__sp = __stack;			\
+    type *__lo = __base;						\
+    size_t __n = __nmemb, __m;						\
+    uint8_t __depth;							\
+									\
+    for (__depth = 0, __m = __n; __m > 1; __m >>= 1)			\
+	__depth += 2;							\
+									\
+    for (;;) {								\
+	if (__n < 8) {							\
+	    /* Insertion sort.	*/					\
+	    type *__i, *__j;						\
+	    for (__i = __lo + 1; __i < __lo + __n; __i++) {		\
+		type __v = *__i;					\
+		for (__j = __i; __j > __lo && less (__v, __j[-1]); __j--) \
+		    *__j = __j[-1];					\
+		*__j = __v;						\
+	    }								\
+	} else if (__depth == 0) {					\
+	    /* Heapsort.	*/					\
+	    size_t __k = __n / 2, __r, __c;				\
+	    __m = __n;							\
+	    for (;;) {							\
+		type __v;						\
+		if (__k) {						\
+		    __v = __lo[--__k];					\
+		} else {						\
+		    if (--__m == 0)					\
+			break;						\
+		    __v = __lo[__m];					\
+		    __lo[__m] = __lo[0];				\
+		}							\
+		for (__r = __k; __r < __m / 2; __r = __c) {		\
+		    __c = 2 * __r + 1;					\
+		    if (__c + 1 < __m && less (__lo[__c], __lo[__c + 1]))	\
+			__c += 1;					\
+		    if (!less (__v, __lo[__c]))				\
+			break;						\
+		    __lo[__r] = __lo[__c];				\
+		}							\
+		__lo[__r] = __v;					\
+	    }								\
+	} else {							\
+	    /* Hoare partition around the median of three.	*/	\
+	    type *__i = __lo, *__j = __lo + __n - 1;			\
+	    type *__p = __lo + (__n - 1) / 2;				\
+	    type __v;							\
+	    size_t __nl;						\
+	    if (less (*__p, *__i)) {					\
+		__v = *__p; *__p = *__i; *__i = __v;			\
+	    }								\
+	    if (less (*__j, *__p)) {					\
+		__v = *__p; *__p = *__j; *__j = __v;			\
+		if (less (*__p, *__i)) {				\
+		    __v = *__p; *__p = *__i; *__i = __v;		\
+		}							\
+	    }								\
+	    __depth -= 1;						\
+	    __v = *__p;							\
+	    for (;;) {							\
+		type __t;						\
+		while (less (*__i, __v))				\
+		    __i++;						\
+		while (less (__v, *__j))				\
+		    __j--;						\
+		if (__i >= __j)						\
+		    break;						\
+		__t = *__i; *__i++ = *__j; *__j-- = __t;		\
+	    }								\
+	    /* [__lo, __j] and [__j + 1, __lo + __n) remain.  Push	\
+	       the larger one, go on with the smaller one.	*/	\
+	    __nl = __j - __lo + 1;					\
+	    __sp->__depth = __depth;					\
+	    if (__nl > __n - __nl) {					\
+		__sp->__lo = __lo;					\
+		__sp->__n = __nl;					\
+		__lo = __j + 1;						\
+		__n -= __nl;						\
+	    } else {							\
+		__sp->__lo = __j + 1;					\
+		__sp->__n = __n - __nl;					\
+		__n = __nl;						\
+	    }								\
+	    __sp++;							\
+	    continue;							\
+	}								\
+	if (__sp == __stack)						\
+	    return;							\
+	__sp--;								\
+	__lo = __sp->__lo;						\
+	__n = __sp->__n;						\
+	__depth = __sp->__depth;					\
+    }									\
+}
+
+/** \ingroup util_sort
+    \def BSEARCH_DEFINE
+    Define <tt>static type *name (type key, const type *base,
+    size_t nmemb)</tt>, which searches the \a nmemb elements at \a
+    base, sorted in ascending order of \a less, for one that is
+    equivalent to \a key: neither orders before the other.
+
+    It returns the first such element, or a null pointer.  Elements
+    of a structure type are searched with a \a key of the same type,
+    in which only the members that \a less looks at need to be set.
+    The search takes <tt>log2(nmemb) + 1</tt> comparisons at most.  */
+#define BSEARCH_DEFINE(name, type, less)				\
+static type *								\
+name (type __key, const type *__base, size_t __nmemb)			\
+{									\
+    const type *__end = __base + __nmemb;				\
+    while (__nmemb) {							\
+	size_t __half = __nmemb / 2;					\
+	if (less (__base[__half], __key)) {				\
+	    __base += __half + 1;					\
+	    __nmemb -= __half + 1;					\
+	} else {							\
+	    __nmemb = __half;						\
+	}								\
+    }									\
+    if (__base == __end || less (__key, *__base))			\
+	return 0;							\
+    return (type *) __base;						\
+}
+
+#endif /* _UTIL_SORT_H_ */
@@ -0,0 +1,101 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE. */
+
+/* $Id$ */
+
+#ifndef _UTIL_TIMER_H_
+#define _UTIL_TIMER_H_
+
+#include <stdint.h>
+
+/** \file */
+/** \defgroup util_timer <util/timer.h>: Software timers
+    \code #include <util/timer.h> \endcode
+
+    Timers which call a function after a number of ticks.  They live
+    on a hashed timing wheel of 32 slots: starting and stopping a timer
+    take constant time, however many timers are running.
+
+    \code
+    static struct timer led;
+
+    static void led_off (struct timer *t)
+    {
+	PORTB &= ~_BV (PB0);
+    }
+
+    timer_start (&led, 50, led_off);
+    \endcode
+
+    The application calls timer_tick() at a fixed rate: along with
+    system_tick() for timers counting seconds, or with clock_tick() for
+    finer ones.  The timers count ticks, not time stamps, so
+    set_system_time() does not affect them.
+*/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** \ingroup util_timer
+    A software timer.  The fields are private to timer_start(),
+    timer_stop() and timer_tick(); a timer must be zeroed before its
+    first use.  The callback receives the timer, which may be a member
+    of a larger struct holding its context.  */
+struct timer {
+    struct timer *next;
+    struct timer **pprev;
+    uint16_t rounds;
+    void (*callback) (struct timer *);
+};
+
+/** \ingroup util_timer
+    Start timer \a t, or restart it if it is running, to call \a callback
+    at the \a ticks'th call of timer_tick() from now, 1 if \a ticks is 0.  */
+extern void timer_start (struct timer *t, uint16_t ticks,
+			 void (*callback) (struct timer *));
+
+/** \ingroup util_timer
+    Stop timer \a t.  Nothing happens if it is not running.  */
+extern void timer_stop (struct timer *t);
+
+/** \ingroup util_timer
+    Advance the timers by one tick, and call the callbacks of those which
+    expire.  Each tick visits only the timers of one slot of the wheel,
+    1/32 of the running timers on average.
+
+    A callback may start or stop any timer, including its own.  Callbacks
+    run with the interrupt state of the caller of timer_tick(), which,
+    unlike system_tick(), must not be called from a 'Naked' ISR.  */
+extern void timer_tick (void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _UTIL_TIMER_H_ */
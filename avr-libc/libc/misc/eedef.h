@@ -48,6 +48,22 @@
 
 # define NVM_BASE	NVM_ADDR0
 
+# ifndef CCP_IOREG_gc
+#  define CCP_IOREG_gc	0xD8	/* IO Register Protection	*/
+# endif
+# ifndef NVM_CMD_READ_EEPROM_gc
+#  define NVM_CMD_READ_EEPROM_gc		0x06
+# endif
+# ifndef NVM_CMD_LOAD_EEPROM_BUFFER_gc
+#  define NVM_CMD_LOAD_EEPROM_BUFFER_gc		0x33
+# endif
+# ifndef NVM_CMD_ERASE_WRITE_EEPROM_PAGE_gc
+#  define NVM_CMD_ERASE_WRITE_EEPROM_PAGE_gc	0x35
+# endif
+# ifndef  NVM_CMD_ERASE_EEPROM_BUFFER_gc
+#  define NVM_CMD_ERASE_EEPROM_BUFFER_gc	0x36
+# endif
+
 #else
 
 # if	!defined (EECR) && defined (DEECR)	/* AT86RF401	*/
@@ -81,6 +97,27 @@
 #  error
 # endif
 
+# if	defined (__ASSEMBLER__) && defined (EEPM0) && defined (EEPM1)
+
+/* Set the programming mode to write r18 over the old byte in r0:
+   erase only when r18 is 0xFF, write only when no bit goes from 0 to 1,
+   erase and write else.  The two first take about half of the time of
+   the last.  Scratch: r0	*/
+	.macro	EEPM_SELECT
+	out	_SFR_IO_ADDR (EECR), __zero_reg__
+	cpi	r18, 0xFF
+	brne	8f
+	sbi	_SFR_IO_ADDR (EECR), EEPM0
+	rjmp	9f
+8:	com	__tmp_reg__
+	and	__tmp_reg__, r18
+	brne	9f
+	sbi	_SFR_IO_ADDR (EECR), EEPM1
+9:
+	.endm
+
+# endif
+
 #endif	/* !__AVR_XMEGA__ */
 #endif	/* !__DOXYGEN__ */
 #endif	/* !_EEDEF_H_ */
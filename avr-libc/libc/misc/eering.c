@@ -0,0 +1,164 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE. */
+
+/* $Id$ */
+
+/* Wear leveling ring of EEPROM records.
+
+   A slot holds the sequence number (2 bytes), the data, and the CCITT
+   CRC of both (2 bytes).  The records are written to the slots in
+   turn, each with the sequence number of the previous one plus 1, so
+   the slots up to the newest one count up from slot 0, the ones after
+   it do not.  The newest slot is found by a binary search over the
+   sequence numbers, and its CRC is checked.  If a write was cut, its
+   slot fails the check, and the slots before are tried.
+
+   The sequence number is written last, and read first.	*/
+
+#include <stdint.h>
+#include <avr/eeprom.h>
+#include <util/crc16.h>
+#include "sectionname.h"
+
+#define HEAD	2		/* the sequence number	*/
+
+static uint16_t
+seq_of (const struct eeprom_ring *r, uint8_t slot)
+{
+    uint16_t seq;
+
+    eeprom_read_block (&seq,
+		       (uint8_t *) r->base + slot * EEPROM_RING_SLOT (r->size),
+		       sizeof (seq));
+    return seq;
+}
+
+/* CCITT CRC of the sequence number and the data.	*/
+static uint16_t
+crc_of (uint16_t seq, const uint8_t *p, uint8_t n, uint8_t eeprom)
+{
+    uint16_t crc = 0xffff;
+    uint8_t buf[8];
+    uint8_t i, k;
+
+    crc = _crc_ccitt_update (crc, seq);
+    crc = _crc_ccitt_update (crc, seq >> 8);
+    while (n) {
+	k = n < sizeof (buf) ? n : sizeof (buf);
+	if (eeprom)
+	    eeprom_read_block (buf, p, k);
+	else
+	    for (i = 0; i < k; i++)
+		buf[i] = p[i];
+	for (i = 0; i < k; i++)
+	    crc = _crc_ccitt_update (crc, buf[i]);
+	p += k;
+	n -= k;
+    }
+    return crc;
+}
+
+ATTRIBUTE_CLIB_SECTION
+int
+eeprom_ring_init (struct eeprom_ring *r, void *base, uint8_t size,
+		  uint8_t slots)
+{
+    uint8_t *p;
+    uint16_t s0, seq, crc;
+    uint8_t lo, hi, mid, n;
+
+    r->base = base;
+    r->size = size;
+    r->slots = slots;
+
+    /* The last slot which counts up from slot 0.	*/
+    s0 = seq_of (r, 0);
+    lo = 0;
+    hi = slots - 1;
+    while (lo < hi) {
+	mid = hi - ((uint8_t)(hi - lo) >> 1);
+	if ((uint16_t)(seq_of (r, mid) - s0) == mid)
+	    lo = mid;
+	else
+	    hi = mid - 1;
+    }
+
+    /* The newest slot with a right CRC.	*/
+    for (n = slots; n; n--) {
+	p = (uint8_t *) base + lo * EEPROM_RING_SLOT (size);
+	seq = seq_of (r, lo);
+	eeprom_read_block (&crc, p + HEAD + size, sizeof (crc));
+	if (crc == crc_of (seq, p + HEAD, size, 1)) {
+	    r->seq = seq;
+	    r->newest = lo;
+	    return 1;
+	}
+	lo = lo ? lo - 1 : slots - 1;
+    }
+
+    /* Nothing valid: the first record goes to slot 0, with 0.	*/
+    r->seq = 0xffff;
+    r->newest = EEPROM_RING_NONE;
+    return 0;
+}
+
+ATTRIBUTE_CLIB_SECTION
+int
+eeprom_ring_read (const struct eeprom_ring *r, void *data)
+{
+    if (r->newest == EEPROM_RING_NONE)
+	return -1;
+    eeprom_read_block (data,
+		       (uint8_t *) r->base
+		       + r->newest * EEPROM_RING_SLOT (r->size) + HEAD,
+		       r->size);
+    return 0;
+}
+
+ATTRIBUTE_CLIB_SECTION
+void
+eeprom_ring_write (struct eeprom_ring *r, const void *data)
+{
+    uint8_t *p;
+    uint16_t seq, crc;
+    uint8_t slot;
+
+    slot = r->newest + 1;
+    if (slot >= r->slots)	/* EEPROM_RING_NONE + 1 is 0	*/
+	slot = 0;
+    p = (uint8_t *) r->base + slot * EEPROM_RING_SLOT (r->size);
+    seq = r->seq + 1;
+    crc = crc_of (seq, data, r->size, 0);
+
+    eeprom_update_block (data, p + HEAD, r->size);
+    eeprom_update_block (&crc, p + HEAD + r->size, sizeof (crc));
+    eeprom_update_block (&seq, p, sizeof (seq));
+
+    r->seq = seq;
+    r->newest = slot;
+}
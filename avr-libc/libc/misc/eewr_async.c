@@ -0,0 +1,160 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE. */
+
+/* $Id$ */
+
+/* Background EEPROM writes, one byte per EEPROM ready interrupt.  */
+
+#ifndef	__DOXYGEN__
+
+#include <avr/io.h>
+
+#if	defined (EE_READY_vect)
+# define EEASYNC_vect	EE_READY_vect
+#elif	defined (EE_RDY_vect)
+# define EEASYNC_vect	EE_RDY_vect
+#elif	defined (EEREADY_vect)
+# define EEASYNC_vect	EEREADY_vect
+#elif	defined (EEPROM_READY_vect)
+# define EEASYNC_vect	EEPROM_READY_vect
+#elif	defined (EEPROM_Ready_vect)
+# define EEASYNC_vect	EEPROM_Ready_vect
+#endif
+
+#if	E2END && __AVR_ARCH__ > 1 && !__AVR_XMEGA__	\
+    && defined (EERIE) && defined (EEASYNC_vect)
+
+#include <stdint.h>
+#include <avr/eeprom.h>
+#include <avr/interrupt.h>
+#include "eedef.h"
+#include "sectionname.h"
+
+/* Number of pending blocks, a power of 2.	*/
+#define QUEUE_SIZE	4
+
+/* Number of unchanged bytes to skip in one interrupt, so that other
+   interrupts are not delayed by a long block.	*/
+#define SKIP_MAX	8
+
+struct eeasync {
+    const uint8_t *src;
+    uint16_t dst;
+    size_t n;
+    void (*done) (void);
+};
+
+static struct eeasync queue[QUEUE_SIZE];
+static volatile uint8_t qhead;
+static volatile uint8_t qcount;
+
+ATTRIBUTE_CLIB_SECTION
+int
+eeprom_write_async (const void *src, void *dst, size_t n, void (*done) (void))
+{
+    struct eeasync *q;
+    uint8_t sreg;
+
+    sreg = SREG;
+    cli ();
+    if (qcount == QUEUE_SIZE) {
+	SREG = sreg;
+	return -1;
+    }
+    q = &queue[(qhead + qcount) & (QUEUE_SIZE - 1)];
+    q->src = src;
+    q->dst = (uint16_t) dst;
+    q->n = n;
+    q->done = done;
+    qcount++;
+    EECR |= _BV (EERIE);
+    SREG = sreg;
+    return 0;
+}
+
+ATTRIBUTE_CLIB_SECTION
+uint8_t
+eeprom_async_busy (void)
+{
+    return qcount;
+}
+
+/* The EEPROM is ready: start the write of the next byte which differs,
+   or finish the block when all of it is written.	*/
+ISR (EEASYNC_vect)
+{
+    struct eeasync *q;
+    void (*done) (void);
+    uint8_t c, old, mode, skip;
+
+    skip = SKIP_MAX;
+    while (qcount) {
+	q = &queue[qhead];
+	while (q->n) {
+	    if (!skip--)
+		return;		/* the interrupt comes again at once	*/
+	    q->n--;
+	    c = *q->src++;
+#ifdef	EEARH
+# if	 E2END > 0xFF
+	    EEARH = q->dst >> 8;
+# else
+	    EEARH = 0;
+# endif
+#endif
+	    EEARL = q->dst;
+	    q->dst++;
+	    EECR |= _BV (EERE);
+	    old = EEDR;
+	    if (old != c) {
+		mode = _BV (EERIE);
+#if	defined (EEPM0) && defined (EEPM1)
+		/* As EEPM_SELECT in eedef.h	*/
+		if (c == 0xFF)
+		    mode |= _BV (EEPM0);	/* erase only	*/
+		else if (!(c & ~old))
+		    mode |= _BV (EEPM1);	/* write only	*/
+#endif
+		EECR = mode;
+		EEDR = c;
+		EECR |= _BV (EEMWE);
+		EECR |= _BV (EEWE);
+		return;
+	    }
+	}
+	done = q->done;
+	qhead = (qhead + 1) & (QUEUE_SIZE - 1);
+	qcount--;
+	if (done)
+	    done ();
+    }
+    EECR &= ~_BV (EERIE);
+}
+
+#endif	/* E2END && EERIE && EEASYNC_vect */
+#endif	/* !__DOXYGEN__ */
@@ -0,0 +1,71 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE. */
+
+/* $Id$ */
+
+#if !defined(__AVR_TINY__)
+
+/** \file */
+
+#include <avr/pgmspace.h>
+#include "sectionname.h"
+
+/** \ingroup avr_pgmspace
+    \brief Binary search of an array in program space.
+
+    The bsearch_PF() function is similar to bsearch_P() except that
+    \p base is a far pointer to the array.  The comparison function is
+    called with \p key and the far address of a member, which it reads
+    with pgm_read_byte_far(), memcmp_PF() and the like.
+
+    \returns The bsearch_PF() function returns the far address of a
+    matching member, or 0 if none matches.
+ */
+
+ATTRIBUTE_CLIB_SECTION
+uint_farptr_t
+bsearch_PF (const void *key, uint_farptr_t base, size_t nmemb, size_t size,
+	    int (*compar) (const void *, uint_farptr_t))
+{
+    uint_farptr_t p;
+    int cmp;
+
+    for (; nmemb != 0; nmemb >>= 1) {
+	p = base + (uint_farptr_t) (nmemb >> 1) * size;
+	cmp = compar (key, p);
+	if (cmp == 0)
+	    return p;
+	if (cmp > 0) {		/* key > p: move right	*/
+	    base = p + size;
+	    nmemb--;
+	}			/* else move left	*/
+    }
+    return 0;
+}
+
+#endif /* !defined(__AVR_TINY__) */
@@ -0,0 +1,107 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE. */
+
+/* $Id$ */
+
+/* Interpolation search in a non-decreasing table in program space,
+   shared by isearch_u16_P(), isearch_u32_P(), isearch_u16_PF() and
+   isearch_u32_PF().  The including file defines:
+	ISEARCH		- the name of the function
+	KEY_T		- uint16_t or uint32_t
+	TABLE_T		- the type of the table address
+	READ(i)		- read element i of the table
+
+   One interpolation over the whole table guesses where the key is.
+   The guess is then widened by steps of 1, 2, 4 ... elements until
+   the key is bracketed, and the bracket is bisected.  So there is one
+   division only, and a table which is close to linear takes a few
+   reads.  However uneven the table, no more than 2*log2(n) + 3 reads
+   are done.	*/
+
+#include <stddef.h>
+#include <stdint.h>
+#include "sectionname.h"
+
+ATTRIBUTE_CLIB_SECTION
+size_t
+ISEARCH (KEY_T key, TABLE_T table, size_t nmemb)
+{
+    KEY_T first, last, d, k;
+    size_t lo, hi, i, step;
+
+    if (nmemb == 0 || key < (first = READ (0)))
+	return 0;
+    last = READ (nmemb - 1);
+    if (key >= last)
+	return nmemb;
+
+    /* Now first <= key < last, so the element at lo - 1 is not greater
+       than the key and the element at hi is greater.	*/
+    lo = 1;
+    hi = nmemb - 1;
+
+    d = last - first;
+    k = key - first;
+#ifdef	KEY_32
+    while (d > 0xffff) {
+	d >>= 1;
+	k >>= 1;
+    }
+#endif
+    i = (uint32_t) k * hi / (uint16_t) d;
+
+    if (READ (i) <= key) {
+	lo = i + 1;
+	for (step = 1; (i = lo - 1 + step) < hi; step <<= 1) {
+	    if (READ (i) > key) {
+		hi = i;
+		break;
+	    }
+	    lo = i + 1;
+	}
+    } else {
+	hi = i;
+	for (step = 1; step <= hi - lo; step <<= 1) {
+	    i = hi - step;
+	    if (READ (i) <= key) {
+		lo = i + 1;
+		break;
+	    }
+	    hi = i;
+	}
+    }
+
+    while (lo < hi) {
+	i = lo + (hi - lo) / 2;
+	if (READ (i) <= key)
+	    lo = i + 1;
+	else
+	    hi = i;
+    }
+    return lo;
+}
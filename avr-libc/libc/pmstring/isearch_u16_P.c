@@ -0,0 +1,59 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE. */
+
+/* $Id$ */
+
+#if !defined(__AVR_TINY__)
+
+/** \file */
+
+#include <avr/pgmspace.h>
+
+/** \ingroup avr_pgmspace
+    \fn size_t isearch_u16_P (uint16_t key, const uint16_t *table, size_t nmemb)
+    \brief Interpolation search of a table in program space.
+
+    The isearch_u16_P() function searches the table of \p nmemb 16-bit
+    values at \p table, which must be in non-decreasing order, for the
+    \p key.  It starts with an interpolation between the first and the
+    last element, so a table which is close to linear, such as a sensor
+    linearization table, is searched with a few reads.
+
+    \returns The number of elements which are less than or equal to
+    \p key: 0 if the key is below the first element, \p nmemb if it is
+    not below the last one.  Otherwise the key lies between elements
+    (result - 1) and (result).
+ */
+
+#define ISEARCH		isearch_u16_P
+#define KEY_T		uint16_t
+#define TABLE_T		const uint16_t *
+#define READ(i)		pgm_read_word (table + (i))
+#include "isearch.h"
+
+#endif /* !defined(__AVR_TINY__) */
@@ -43,6 +43,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include "pow10_scale.h"
 #include "sectionname.h"
 #include "stdio_private.h"
 
@@ -392,19 +393,6 @@ conv_brk (FILE *stream, width_t width, char *addr, const char *fmt)
 
 #if  SCANF_FLOAT
 
-/* GCC before 4.2 does not use a library function to convert an unsigned
-   long to float.  Instead it uses a signed long to float conversion
-   function along with a large inline code to correct the result.
-   Seems, GCC 4.3 does not use it also.	*/
-extern double __floatunsisf (unsigned long);
-
-PROGMEM static const float pwr_p10 [6] = {
-    1e+1, 1e+2, 1e+4, 1e+8, 1e+16, 1e+32
-};
-PROGMEM static const float pwr_m10 [6] = {
-    1e-1, 1e-2, 1e-4, 1e-8, 1e-16, 1e-32
-};
-
 PROGMEM static const char pstr_nfinity[] = "nfinity";
 PROGMEM static const char pstr_an[] = "an";
 
@@ -523,25 +511,7 @@ static unsigned char conv_flt (FILE *stream, width_t width, float *addr)
 
 	if (width && i >= 0) ungetc (i, stream);
     
-	x.flt = __floatunsisf (x.u32);
-
-	if (exp < 0) {
-	    p = (void *)(pwr_m10 + 5);
-	    exp = -exp;
-	} else {
-	    p = (void *)(pwr_p10 + 5);
-	}
-	for (width = 32; width; width >>= 1) {
-	    for (; (unsigned)exp >= width; exp -= width) {
-		union {
-		    long lo;
-		    float fl;
-		} y;
-		y.lo = pgm_read_dword (p);
-		x.flt *= y.fl;
-	    }
-	    p = (void *)p - sizeof(float);
-	}
+	x.flt = __pow10_scale (x.u32, exp);
     } /* switch */
 
     if (flag & FL_MINUS)
@@ -0,0 +1,105 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE. */
+
+/* $Id$ */
+
+#if !defined(__AVR_TINY__)
+
+#include <avr/pgmspace.h>
+#include "pow10_scale.h"
+#include "sectionname.h"
+
+extern double __floatunsisf (unsigned long);
+
+/* The largest mantissa that a float holds exactly: 2**24.	*/
+#define MANT_EXACT	0x1000000UL
+
+/* Powers of ten which a float holds exactly: 5**10 < 2**24.	*/
+PROGMEM static const float pwr_exact [11] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10
+};
+
+PROGMEM static const float pwr_p10 [6] = {
+    1e+1, 1e+2, 1e+4, 1e+8, 1e+16, 1e+32
+};
+PROGMEM static const float pwr_m10 [6] = {
+    1e-1, 1e-2, 1e-4, 1e-8, 1e-16, 1e-32
+};
+
+/* Scale a decimal mantissa by a power of ten.
+
+   Fast path: if the mantissa is exact in float (<= 2**24) and the power
+   of ten is exact also (|exp| <= 10), the result is a single multiply or
+   divide of two exact operands and so it is correctly rounded.  A large
+   positive 'exp' is moved into the mantissa while it stays exact (for
+   example, "1e15" is 100000 * 1e10).  A zero 'exp' needs the integer to
+   float conversion only.
+
+   Other values are scaled with the binary powers of ten, as before.	*/
+ATTRIBUTE_CLIB_SECTION
+double
+__pow10_scale (unsigned long mant, int exp)
+{
+    union {
+	unsigned long u32;
+	float flt;
+    } x, y;
+    const float *p;
+    unsigned char pwr;
+
+    while (exp > 10 && mant < MANT_EXACT / 10) {
+	mant = ((mant << 2) + mant) << 1;	/* mant *= 10	*/
+	exp -= 1;
+    }
+
+    x.flt = __floatunsisf (mant);
+    if (!exp || !mant)
+	return x.flt;
+
+    if (mant <= MANT_EXACT && exp >= -10 && exp <= 10) {
+	y.u32 = pgm_read_dword (pwr_exact + (exp < 0 ? -exp : exp));
+	return (exp < 0) ? x.flt / y.flt : x.flt * y.flt;
+    }
+
+    if (exp < 0) {
+	p = pwr_m10 + 5;
+	exp = -exp;
+    } else {
+	p = pwr_p10 + 5;
+    }
+    for (pwr = 32; pwr; pwr >>= 1) {
+	for (; exp >= pwr; exp -= pwr) {
+	    y.u32 = pgm_read_dword (p);
+	    x.flt *= y.flt;
+	}
+	p -= 1;
+    }
+    return x.flt;
+}
+
+#endif
@@ -27,39 +27,58 @@
  * SUCH DAMAGE.
  */
 
+#include <stdint.h>
 #include <stdlib.h>
 #include "sectionname.h"
 
 typedef int cmp_t(const void *, const void *);
-static char *med3(char *, char *, char *, cmp_t *);
-static void swapfunc(char *, char *, int);
+
+/* Partitions of fewer elements are finished by insertion sort.	*/
+#define THRESH		7
+
+/* Pending partitions.  The larger side of a split is pushed and the
+   smaller one is sorted at once, so every push at least halves the
+   number of elements: one slot per bit of size_t is always enough.  */
+#define STACK_SIZE	(8 * sizeof (size_t))
 
 #define min(a, b)	((a) < (b) ? (a) : (b))
 
 /*
- * Qsort routine from Bentley & McIlroy's "Engineering a Sort Function".
+ * Exchange n bytes at a and b, which hold elements of es bytes.  The
+ * common 2- and 4-byte elements are moved a word at a time.
  */
-#define swapcode(TYPE, parmi, parmj, n) { 		\
-	int i = (n) / sizeof (TYPE); 			\
-	register TYPE *pi = (TYPE *) (parmi); 		\
-	register TYPE *pj = (TYPE *) (parmj); 		\
-	do { 						\
-		register TYPE	t = *pi;		\
-		*pi++ = *pj;				\
-		*pj++ = t;				\
-        } while (--i > 0);				\
-}
-
 ATTRIBUTE_CLIB_SECTION
 static void
-swapfunc(char *a, char *b, int n)
+swapfunc(char *a, char *b, size_t n, size_t es)
 {
-	swapcode(char, a, b, n)
+	if (es == 2) {
+		uint16_t *pi = (uint16_t *) a, *pj = (uint16_t *) b;
+		n /= 2;
+		do {
+			uint16_t t = *pi;
+			*pi++ = *pj;
+			*pj++ = t;
+		} while (--n);
+	} else if (es == 4) {
+		uint32_t *pi = (uint32_t *) a, *pj = (uint32_t *) b;
+		n /= 4;
+		do {
+			uint32_t t = *pi;
+			*pi++ = *pj;
+			*pj++ = t;
+		} while (--n);
+	} else {
+		do {
+			char t = *a;
+			*a++ = *b;
+			*b++ = t;
+		} while (--n);
+	}
 }
 
-#define swap(a, b) swapfunc(a, b, es)
+#define swap(a, b)	swapfunc(a, b, es, es)
 
-#define vecswap(a, b, n) 	if ((n) > 0) swapfunc(a, b, n)
+#define vecswap(a, b, n) 	if ((n) > 0) swapfunc(a, b, n, es)
 
 ATTRIBUTE_CLIB_SECTION
 static char *
@@ -70,83 +89,190 @@ med3(char *a, char *b, char *c, cmp_t *cmp)
               :(cmp(b, c) > 0 ? b : (cmp(a, c) < 0 ? a : c ));
 }
 
+/*
+ * Insertion sort.  It gives up, returning 0, once more than limit
+ * elements have been moved.
+ */
 ATTRIBUTE_CLIB_SECTION
-void
-qsort(void *a, size_t n, size_t es, cmp_t *cmp)
+static int
+inssort(char *a, size_t n, size_t es, cmp_t *cmp, size_t limit)
 {
-	char *pa, *pb, *pc, *pd, *pl, *pm, *pn;
-	int d, r, swap_cnt;
-
-loop:
-	swap_cnt = 0;
-	if (n < 7) {
-		for (pm = (char *)a + es; pm < (char *)a + n * es; pm += es)
-			for (pl = pm; pl > (char *)a && cmp(pl - es, pl) > 0;
-			     pl -= es)
-				swap(pl, pl - es);
-		return;
-	}
-	pm = (char *)a + (n / 2) * es;
-	if (n > 7) {
-		pl = a;
-		pn = (char *)a + (n - 1) * es;
-		if (n > 40) {
-			d = (n / 8) * es;
-			pl = med3(pl, pl + d, pl + 2 * d, cmp);
-			pm = med3(pm - d, pm, pm + d, cmp);
-			pn = med3(pn - 2 * d, pn - d, pn, cmp);
+	char *pl, *pm;
+
+	for (pm = a + es; pm < a + n * es; pm += es)
+		for (pl = pm; pl > a && cmp(pl - es, pl) > 0; pl -= es) {
+			if (limit-- == 0)
+				return 0;
+			swap(pl, pl - es);
+		}
+	return 1;
+}
+
+/*
+ * Let the element at index i sink through the heap of n elements.
+ */
+ATTRIBUTE_CLIB_SECTION
+static void
+siftdown(char *a, size_t i, size_t n, size_t es, cmp_t *cmp)
+{
+	char *pi, *pc;
+	size_t c;
+
+	while (i < n / 2) {
+		c = 2 * i + 1;
+		pi = a + i * es;
+		pc = a + c * es;
+		if (c + 1 < n && cmp(pc, pc + es) < 0) {
+			c += 1;
+			pc += es;
 		}
-		pm = med3(pl, pm, pn, cmp);
+		if (cmp(pi, pc) >= 0)
+			break;
+		swap(pi, pc);
+		i = c;
 	}
-	swap(a, pm);
-	pa = pb = (char *)a + es;
+}
+
+/*
+ * Heapsort: the O(n log n) fallback when partitioning goes badly.
+ */
+ATTRIBUTE_CLIB_SECTION
+static void
+hsort(char *a, size_t n, size_t es, cmp_t *cmp)
+{
+	size_t i;
+
+	for (i = n / 2; i > 0; )
+		siftdown(a, --i, n, es, cmp);
+	for (i = n - 1; i > 0; i--) {
+		swap(a, a + i * es);
+		siftdown(a, 0, i, es, cmp);
+	}
+}
+
+/*
+ * Introsort built on the partitioning of Bentley & McIlroy's
+ * "Engineering a Sort Function".  There is no recursion: pending
+ * partitions wait on a small local stack.  A partition that is split
+ * more than 2*log2(n) times is handed to heapsort.
+ */
+ATTRIBUTE_CLIB_SECTION
+void
+qsort(void *base, size_t n, size_t es, cmp_t *cmp)
+{
+	struct {
+		char *a;
+		size_t n;
+		unsigned char depth;
+	} stack[STACK_SIZE], *sp = stack;
+	char *a = base;
+	char *pa, *pb, *pc, *pd, *pl, *pm, *pn;
+	size_t d, r, s;
+	unsigned char depth;
+	int cmp_result, swap_cnt;
+
+	for (depth = 0, r = n; r > 1; r >>= 1)
+		depth += 2;
 
-	pc = pd = (char *)a + (n - 1) * es;
 	for (;;) {
-		while (pb <= pc && (r = cmp(pb, a)) <= 0) {
-			if (r == 0) {
-				swap_cnt = 1;
-				swap(pa, pb);
-				pa += es;
+		if (n < THRESH) {
+			inssort(a, n, es, cmp, (size_t)-1);
+			goto pop;
+		}
+		if (depth == 0) {
+			hsort(a, n, es, cmp);
+			goto pop;
+		}
+		depth -= 1;
+
+		pm = a + (n / 2) * es;
+		if (n > 7) {
+			pl = a;
+			pn = a + (n - 1) * es;
+			if (n > 40) {
+				d = (n / 8) * es;
+				pl = med3(pl, pl + d, pl + 2 * d, cmp);
+				pm = med3(pm - d, pm, pm + d, cmp);
+				pn = med3(pn - 2 * d, pn - d, pn, cmp);
 			}
-			pb += es;
+			pm = med3(pl, pm, pn, cmp);
 		}
-		while (pb <= pc && (r = cmp(pc, a)) >= 0) {
-			if (r == 0) {
-				swap_cnt = 1;
-				swap(pc, pd);
-				pd -= es;
+		swap(a, pm);
+		pa = pb = a + es;
+		swap_cnt = 0;
+
+		pc = pd = a + (n - 1) * es;
+		for (;;) {
+			while (pb <= pc && (cmp_result = cmp(pb, a)) <= 0) {
+				if (cmp_result == 0) {
+					swap_cnt = 1;
+					swap(pa, pb);
+					pa += es;
+				}
+				pb += es;
 			}
+			while (pb <= pc && (cmp_result = cmp(pc, a)) >= 0) {
+				if (cmp_result == 0) {
+					swap_cnt = 1;
+					swap(pc, pd);
+					pd -= es;
+				}
+				pc -= es;
+			}
+			if (pb > pc)
+				break;
+			swap(pb, pc);
+			swap_cnt = 1;
+			pb += es;
 			pc -= es;
 		}
-		if (pb > pc)
-			break;
-		swap(pb, pc);
-		swap_cnt = 1;
-		pb += es;
-		pc -= es;
-	}
-	if (swap_cnt == 0) {  /* Switch to insertion sort */
-		for (pm = (char *)a + es; pm < (char *)a + n * es; pm += es)
-			for (pl = pm; pl > (char *)a && cmp(pl - es, pl) > 0;
-			     pl -= es)
-				swap(pl, pl - es);
-		return;
-	}
 
-	pn = (char *)a + n * es;
-	r = min(pa - (char *)a, pb - pa);
-	vecswap(a, pb - r, r);
-	r = min(pd - pc, pn - pd - es);
-	vecswap(pb, pn - r, r);
-	if ((r = pb - pa) > es)
-		qsort(a, r / es, es, cmp);
-	if ((r = pd - pc) > es) {
-		/* Iterate rather than recurse to save stack space */
-		a = pn - r;
-		n = r / es;
-		goto loop;
+		pn = a + n * es;
+		r = min(pa - a, pb - pa);
+		vecswap(a, pb - r, r);
+		r = min(pd - pc, pn - pd - es);
+		vecswap(pb, pn - r, r);
+
+		/* Elements less than the pivot are now at a, r bytes, and
+		   the greater ones at pn - s, s bytes.	*/
+		r = pb - pa;
+		s = pd - pc;
+
+		/* Nothing was swapped: the input may be nearly sorted.  Try
+		   to finish both sides with insertion sort, but give up
+		   after a linear number of moves.	*/
+		if (swap_cnt == 0
+		    && inssort(a, r / es, es, cmp, r / es)
+		    && inssort(pn - s, s / es, es, cmp, s / es))
+			goto pop;
+		if (r < s) {
+			d = r;
+			r = s;
+			s = d;
+			pl = a;
+			a = pn - r;
+		} else {
+			pl = pn - s;
+		}
+		/* Now r bytes at a are the larger side, s bytes at pl the
+		   smaller one.	*/
+		if (r > es) {
+			sp->a = a;
+			sp->n = r / es;
+			sp->depth = depth;
+			sp++;
+		}
+		if (s > es) {
+			a = pl;
+			n = s / es;
+			continue;
+		}
+	  pop:
+		if (sp == stack)
+			return;
+		sp--;
+		a = sp->a;
+		n = sp->n;
+		depth = sp->depth;
 	}
-/*		qsort(pn - r, r / es, es, cmp);*/
 }
-
@@ -0,0 +1,120 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE. */
+
+/* $Id$ */
+
+#if !defined(__AVR_TINY__)
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sectionname.h"
+
+extern void __radix_pass (void *, const void *, size_t, uint8_t, uint8_t,
+			     uint16_t *, const uint16_t *, uint16_t *);
+
+/* LSD radix sort on 4-bit digits.  Digits which are the same in all
+   keys are skipped, so 10-bit ADC values sorted as 16-bit keys take 3
+   passes, not 4.	*/
+ATTRIBUTE_CLIB_SECTION
+static void
+radixsort (void *base, size_t nmemb, uint8_t es, void *tmp,
+	   unsigned int *data)
+{
+    uint16_t tab[32];
+    void *src = base;
+    void *dst = tmp;
+    uint16_t *psrc = 0;
+    uint16_t *pdst = 0;
+    uint8_t any[4], all[4];
+    uint8_t digit, i;
+    const uint8_t *p;
+    size_t n;
+
+    if (nmemb < 2)
+	return;
+
+    /* The bits that differ between keys.	*/
+    memset (any, 0, sizeof (any));
+    memset (all, 0xff, sizeof (all));
+    for (p = base, n = nmemb; n; n--) {
+	for (i = 0; i < es; i++) {
+	    any[i] |= *p;
+	    all[i] &= *p++;
+	}
+    }
+    if (data) {
+	psrc = data;
+	pdst = (uint16_t *) ((char *) tmp + nmemb * es);
+    }
+
+    for (digit = 0; digit < 2 * es; digit++) {
+	i = any[digit / 2] ^ all[digit / 2];
+	if (i & ((digit & 1) ? 0xf0 : 0x0f)) {
+	    void *t = src;
+	    uint16_t *pt = psrc;
+	    __radix_pass (dst, src, nmemb, es, digit, pdst, psrc, tab);
+	    src = dst;
+	    dst = t;
+	    psrc = pdst;
+	    pdst = pt;
+	}
+    }
+
+    if (src != base) {
+	memcpy (base, src, nmemb * es);
+	if (data)
+	    memcpy (data, psrc, nmemb * sizeof (*data));
+    }
+}
+
+ATTRIBUTE_CLIB_SECTION
+void
+radixsort_u8 (unsigned char *base, size_t nmemb, void *tmp,
+	      unsigned int *data)
+{
+    radixsort (base, nmemb, 1, tmp, data);
+}
+
+ATTRIBUTE_CLIB_SECTION
+void
+radixsort_u16 (unsigned int *base, size_t nmemb, void *tmp,
+	       unsigned int *data)
+{
+    radixsort (base, nmemb, 2, tmp, data);
+}
+
+ATTRIBUTE_CLIB_SECTION
+void
+radixsort_u32 (unsigned long *base, size_t nmemb, void *tmp,
+	       unsigned int *data)
+{
+    radixsort (base, nmemb, 4, tmp, data);
+}
+
+#endif	/* !__AVR_TINY__ */
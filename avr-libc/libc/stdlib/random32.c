@@ -0,0 +1,76 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE. */
+
+/* $Id$ */
+
+#if !defined(__AVR_TINY__)
+
+#include <stdlib.h>
+#include "sectionname.h"
+
+extern unsigned long __xorshift32 (unsigned long);
+
+/* A state of 0 would never change: use another value.  The same is
+   done by random_fill_r().	*/
+#define SEED	2463534242UL
+
+ATTRIBUTE_CLIB_SECTION
+unsigned long
+random32_r (unsigned long *ctx)
+{
+    unsigned long x = *ctx;
+
+    if (x == 0)
+	x = SEED;
+    return *ctx = __xorshift32 (x);
+}
+
+static unsigned long next = SEED;
+
+ATTRIBUTE_CLIB_SECTION
+unsigned long
+random32 (void)
+{
+    return random32_r (&next);
+}
+
+ATTRIBUTE_CLIB_SECTION
+void
+srandom32 (unsigned long seed)
+{
+    next = seed;
+}
+
+ATTRIBUTE_CLIB_SECTION
+void
+random_fill (void *buf, size_t n)
+{
+    random_fill_r (buf, n, &next);
+}
+
+#endif	/* !__AVR_TINY__ */
@@ -40,20 +40,9 @@
 #include <limits.h>
 #include <math.h>		/* INFINITY, NAN		*/
 #include <stdlib.h>
+#include "pow10_scale.h"
 #include "sectionname.h"
 
-/* Only GCC 4.2 calls the library function to convert an unsigned long
-   to float.  Other GCC-es (including 4.3) use a signed long to float
-   conversion along with a large inline code to correct the result.	*/
-extern double __floatunsisf (unsigned long);
-
-PROGMEM static const float pwr_p10 [6] = {
-    1e+1, 1e+2, 1e+4, 1e+8, 1e+16, 1e+32
-};
-PROGMEM static const float pwr_m10 [6] = {
-    1e-1, 1e-2, 1e-4, 1e-8, 1e-16, 1e-32
-};
-
 /* PSTR() is not used to save 1 byte per string: '\0' at the tail.	*/
 PROGMEM static const char pstr_inf[] = {'I','N','F'};
 PROGMEM static const char pstr_inity[] = {'I','N','I','T','Y'};
@@ -194,32 +183,15 @@ strtod (const char * nptr, char ** endptr)
     if ((flag & FL_ANY) && endptr)
 	*endptr = (char *)nptr - 1;
     
-    x.flt = __floatunsisf (x.u32);		/* manually	*/
-    if ((flag & FL_MINUS) && (flag & FL_ANY))
-	x.flt = -x.flt;
-	
-    if (x.flt != 0) {
-	int pwr;
-	if (exp < 0) {
-	    nptr = (void *)(pwr_m10 + 5);
-	    exp = -exp;
-	} else {
-	    nptr = (void *)(pwr_p10 + 5);
-	}
-	for (pwr = 32; pwr; pwr >>= 1) {
-	    for (; exp >= pwr; exp -= pwr) {
-		union {
-		    unsigned long u32;
-		    float flt;
-		} y;
-		y.u32 = pgm_read_dword ((float *)nptr);
-		x.flt *= y.flt;
-	    }
-	    nptr -= sizeof(float);
-	}
+    /* The mantissa and the power of ten are scaled together: short
+       decimals are converted exactly by one multiply or divide.	*/
+    if (x.u32) {
+	x.flt = __pow10_scale (x.u32, exp);
 	if (!isfinite(x.flt) || x.flt == 0)
 	    errno = ERANGE;
     }
+    if ((flag & FL_MINUS) && (flag & FL_ANY))
+	x.flt = -x.flt;
 
     return x.flt;
 }
@@ -33,7 +33,7 @@
 
 */
 #include <time.h>
-#include <stdlib.h>
+#include <util/divmod.h>
 
 #ifdef __MEMX
 const __memx char ascmonths[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
@@ -49,7 +49,7 @@ void
 asctime_r(const struct tm * timeptr, char *buffer)
 {
 	unsigned char   i, m, d;
-	div_t result;
+	udiv16_t result;
 
 	d = timeptr->tm_wday * 3;
 	m = timeptr->tm_mon * 3;
@@ -72,7 +72,7 @@ asctime_r(const struct tm * timeptr, char *buffer)
 	__print_lz(timeptr->tm_sec,buffer,' ');
 	buffer += 3;
 
-	result = div(timeptr->tm_year + 1900 , 100);
+	result = udivmod16_100(timeptr->tm_year + 1900);
 
 	__print_lz(result.quot,buffer,' ');
 	buffer += 2;
@@ -40,5 +40,6 @@
 #define TROP_CYCLE 5022440.6025
 #define ANOM_CYCLE 5022680.6082
 #define DELTA_V 0.03342044    /* 2x orbital eccentricity */
+#define LAG 38520              /* spreads the solstice error over 2000 ... 2135 */
 
 #endif
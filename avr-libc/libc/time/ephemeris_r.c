@@ -0,0 +1,104 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE. */
+
+/* $Id$ */
+
+/*
+    Compute the solar ephemeris of a day at the position of the observer, as
+    solar_declination(), equation_of_time(), daylight_seconds(), solar_noon(),
+    sun_rise() and sun_set() would at noon UTC of that day. The orbital angle
+    relative to perihelion is shared by the declination and the equation of
+    time, and noon, rise and set share both. Nothing is computed while the day
+    and the position stay the same.
+*/
+
+#include <time.h>
+#include <math.h>
+#include "ephemera_common.h"
+
+extern long     __latitude;
+extern long     __longitude;
+
+void
+ephemeris_r(const time_t * timer, struct ephemeris * eph)
+{
+    uint16_t        day;
+    time_t          t;
+    uint32_t        p, s;
+    double          pf, dV, d;
+
+    day = *timer / ONE_DAY + 1;
+    if (day == eph->day && __latitude == eph->latitude && __longitude == eph->longitude)
+        return;
+    eph->day = day;
+    eph->latitude = __latitude;
+    eph->longitude = __longitude;
+
+    /* noon UTC of the day */
+    t = *timer - *timer % ONE_DAY + 43200L;
+
+    /* orbital position relative to perihelion, and velocity correction factor */
+    p = t % ANOM_YEAR;
+    p += PERIHELION;
+    pf = p;
+    pf /= ANOM_CYCLE;
+    pf = sin(pf);
+    dV = pf * DELTA_V;
+
+    /* orbital position relative to the December solstice */
+    s = t % TROP_YEAR;
+    s += SOLSTICE;
+
+    /* declination */
+    d = s + LAG;
+    d /= TROP_CYCLE;
+    d += dV;
+    eph->declination = -cos(d) * INCLINATION;
+
+    /* equation of time */
+    d = 2 * s;
+    d /= TROP_CYCLE;
+    d += dV;
+    d = sin(d) * 592.2 + pf * 459.6;
+    eph->equation = -(int32_t) d;
+
+    /* solar noon at the observers longitude */
+    eph->noon = t - eph->equation - __longitude / 15L;
+
+    /* length of the day, from the 'Sunrise Equation' as in daylight_seconds() */
+    d = tan(__latitude / 206264.806) * tan(-eph->declination);
+    if (d > 1.0)
+        d = 1.0;
+    if (d < -1.0)
+        d = -1.0;
+    d = acos(d) / 3.112505;
+    eph->daylight = ONE_DAY * d;
+
+    eph->rise = eph->noon - eph->daylight / 2L;
+    eph->set = eph->noon + eph->daylight / 2L;
+}
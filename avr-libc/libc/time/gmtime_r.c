@@ -31,114 +31,81 @@
 /* Re entrant version of gmtime(). */
 
 #include <time.h>
-#include <stdlib.h>
 #include <inttypes.h>
+#include <util/divmod.h>
+
+/*
+    The calendar arithmetic counts days from March 1st, 1996, so that the
+    leap day is the last day of a year and the 4 year cycles are regular:
+    1461 days each, the leap year last.  The one irregular year of our
+    range, 2100, is made regular by inserting a virtual 29th of February;
+    no time stamp ever maps to it.  Months of the March based year follow
+    the pattern 31, 30, 31, 30, 31 twice (then 31, 28), so the month and
+    the days before it are linear functions, rounded.
+
+    All divisions are by constants and done by multiplying with a scaled
+    reciprocal, which is exact over the range of days of a time_t.
+*/
+
+#define MARCH_1996      1401    /* days from March 1st, 1996 to the epoch */
+#define MARCH_2100      37985   /* days from March 1st, 1996 to March 1st, 2100 */
 
 void
 gmtime_r(const time_t * timer, struct tm * timeptr)
 {
-    int32_t         fract;
-    ldiv_t          lresult;
-    div_t           result;
-    uint16_t        days, n, leapyear, years;
+    udiv32_t        lresult;
+    udiv16_t        result;
+    uint16_t        days, n, cycles, years;
 
     /* break down timer into whole and fractional parts of 1 day */
-    days = *timer / 86400UL;
-    fract = *timer % 86400UL;
+    lresult = udivmod32_86400(*timer);
+    days = lresult.quot;
 
     /*
             Extract hour, minute, and second from the fractional day
         */
-    lresult = ldiv(fract, 60L);
+    lresult = udivmod32_60(lresult.rem);
     timeptr->tm_sec = lresult.rem;
-    result = div(lresult.quot, 60);
+    result = udivmod16_60(lresult.quot);
     timeptr->tm_min = result.rem;
     timeptr->tm_hour = result.quot;
 
     /* Determine day of week ( the epoch was a Saturday ) */
     n = days + SATURDAY;
-    n %= 7;
-    timeptr->tm_wday = n;
-
-    /*
-        * Our epoch year has the property of being at the conjunction of all three 'leap cycles',
-        * 4, 100, and 400 years ( though we can ignore the 400 year cycle in this library).
-        *
-        * Using this property, we can easily 'map' the time stamp into the leap cycles, quickly
-        * deriving the year and day of year, along with the fact of whether it is a leap year.
-        */
-
-    /* map into a 100 year cycle */
-    lresult = ldiv((long) days, 36525L);
-    years = 100 * lresult.quot;
+    timeptr->tm_wday = udivmod16_7(n).rem;
 
-    /* map into a 4 year cycle */
-    lresult = ldiv(lresult.rem, 1461L);
-    years += 4 * lresult.quot;
-    days = lresult.rem;
-    if (years > 100)
+    /* days since March 1st, 1996, with the virtual 2100-02-29 */
+    days += MARCH_1996;
+    if (days >= MARCH_2100)
         days++;
 
-    /*
-         * 'years' is now at the first year of a 4 year leap cycle, which will always be a leap year,
-         * unless it is 100. 'days' is now an index into that cycle.
-         */
-    leapyear = 1;
-    if (years == 100)
-        leapyear = 0;
-
-    /* compute length, in days, of first year of this cycle */
-    n = 364 + leapyear;
-
-    /*
-     * if the number of days remaining is greater than the length of the
-     * first year, we make one more division.
-     */
-    if (days > n) {
-        days -= leapyear;
-        leapyear = 0;
-        result = div(days, 365);
-        years += result.quot;
-        days = result.rem;
-    }
-    timeptr->tm_year = 100 + years;
-    timeptr->tm_yday = days;
-
-    /*
-            Given the year, day of year, and leap year indicator, we can break down the
-            month and day of month. If the day of year is less than 59 (or 60 if a leap year), then
-            we handle the Jan/Feb month pair as an exception.
-        */
-    n = 59 + leapyear;
-    if (days < n) {
-        /* special case: Jan/Feb month pair */
-        result = div(days, 31);
-        timeptr->tm_mon = result.quot;
-        timeptr->tm_mday = result.rem;
+    /* 4 year cycle: days / 1461, exact for days < 51114 */
+    cycles = ((uint32_t) days * 22967U) >> 25;
+    days -= 1461 * cycles;
+
+    /* year within the cycle, only the last one has 366 days */
+    years = (days >= 365) + (days >= 730) + (days >= 1095);
+    days -= 365 * years;
+    years += 4 * cycles;
+
+    /* month from March: (5 * days + 2) / 153 */
+    n = ((uint32_t) days * 2140U + 1330) >> 16;
+    timeptr->tm_mday = days - ((979 * n + 15) >> 5) + 1;
+
+    if (n < 10) {
+        /* March to December */
+        timeptr->tm_mon = n + MARCH;
+        timeptr->tm_year = 96 + years;
+        timeptr->tm_yday = days + 59;
+        /* the years of the cycle from 1996 on are leap years, but 2100 */
+        if ((years & 3) == 0 && years != 2100 - 1996)
+            timeptr->tm_yday++;
     } else {
-        /*
-            The remaining 10 months form a regular pattern of 31 day months alternating with 30 day
-            months, with a 'phase change' between July and August (153 days after March 1).
-            We proceed by mapping our position into either March-July or August-December.
-            */
-        days -= n;
-        result = div(days, 153);
-        timeptr->tm_mon = 2 + result.quot * 5;
-
-        /* map into a 61 day pair of months */
-        result = div(result.rem, 61);
-        timeptr->tm_mon += result.quot * 2;
-
-        /* map into a month */
-        result = div(result.rem, 31);
-        timeptr->tm_mon += result.quot;
-        timeptr->tm_mday = result.rem;
+        /* January and February belong to the next year */
+        timeptr->tm_mon = n - 10;
+        timeptr->tm_year = 97 + years;
+        timeptr->tm_yday = days - 306;
     }
 
-    /*
-            Cleanup and return
-        */
     timeptr->tm_isdst = 0;  /* gmt is never in DST */
-    timeptr->tm_mday++; /* tm_mday is 1 based */
-
 }
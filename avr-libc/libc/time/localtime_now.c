@@ -0,0 +1,96 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE. */
+
+/* $Id$ */
+
+/*
+	Return the local time in constant time. The broken-down time is computed
+	once by localtime_r(), then system_tick() advances it through
+	__tm_now_tick(). set_system_time(), set_zone() and set_dst() make it
+	stale, and so does __tm_now_tick() every quarter hour if a Daylight
+	Saving function is set.
+*/
+
+#include <time.h>
+
+extern volatile time_t __system_time;
+
+extern void     (*__tick_hook) (void);
+
+extern void     __tm_now_tick(void);
+
+extern struct tm __tm_store;
+
+struct tm       __tm_now;
+
+struct tm      *
+localtime_now(void)
+{
+	time_t          t;
+	uint8_t         sreg;
+
+	for (;;) {
+		asm             volatile(
+				                 "in %0, __SREG__" "\n\t"
+				                 "cli"
+				 : "=r"(sreg) :: "memory"
+		);
+		if (__tick_hook)
+			break;
+		t = __system_time;
+		asm             volatile(
+				                 "out __SREG__, %0"
+				 :: "r"(sreg) : "memory"
+		);
+
+		/* the hook is null, so system_tick() leaves __tm_now alone */
+		localtime_r(&t, &__tm_now);
+
+		asm             volatile(
+				                 "cli"
+				 ::: "memory"
+		);
+		if (__system_time == t) {
+			__tick_hook = __tm_now_tick;
+			break;
+		}
+		asm             volatile(
+				                 "out __SREG__, %0"
+				 :: "r"(sreg) : "memory"
+		);
+	}
+
+	/* take a copy, which a tick cannot change while it is read */
+	__tm_store = __tm_now;
+	asm             volatile(
+			                 "out __SREG__, %0"
+			 :: "r"(sreg) : "memory"
+	);
+
+	return &__tm_store;
+}
@@ -36,78 +36,55 @@
 
 #include <time.h>
 
+/*
+    The reverse of the calendar arithmetic of gmtime_r(): count days from
+    March 1st, 1996, with 4 year cycles of 1461 days and a virtual 29th of
+    February, 2100.  No divisions are needed.
+*/
+
+#define MARCH_1996      1401    /* days from March 1st, 1996 to the epoch */
+#define MARCH_2100      37985   /* days from March 1st, 1996 to March 1st, 2100 */
+
 time_t
 mk_gmtime(const struct tm * timeptr)
 {
 
-    time_t          ret;
     uint32_t        tmp;
-    int             n, m, d, leaps;
+    int             years, mon;
+    long            days;
 
     /*
-        Determine elapsed whole days since the epoch to the beginning of this year. Since our epoch is
-        at a conjunction of the leap cycles, we can do this rather quickly.
+        January and February are the last months of the previous March
+        based year.
         */
-    n = timeptr->tm_year - 100;
-    leaps = 0;
-    if (n) {
-        m = n - 1;
-        leaps = m / 4;
-        leaps -= m / 100;
-        leaps++;
+    years = timeptr->tm_year - 96;
+    mon = timeptr->tm_mon - MARCH;
+    if (mon < 0) {
+        mon += 12;
+        years--;
     }
-    tmp = 365UL * n + leaps;
-
-    /*
-                Derive the day of year from month and day of month. We use the pattern of 31 day months
-                followed by 30 day months to our advantage, but we must 'special case' Jan/Feb, and
-                account for a 'phase change' between July and August (153 days after March 1).
-            */
-    d = timeptr->tm_mday - 1;   /* tm_mday is one based */
 
-    /* handle Jan/Feb as a special case */
-    if (timeptr->tm_mon < 2) {
-        if (timeptr->tm_mon)
-            d += 31;
+    /* whole 4 year cycles, then years and months */
+    days = 1461L * (years >> 2) + 365 * (years & 3);
+    days += (979 * mon + 15) >> 5;
 
-    } else {
-        n = 59 + is_leap_year(timeptr->tm_year + 1900);
-        d += n;
-        n = timeptr->tm_mon - MARCH;
-
-        /* account for phase change */
-        if (n > (JULY - MARCH))
-            d += 153;
-        n %= 5;
+    /*
+        drop the virtual 29th of February, 2100, from months starting
+        with March 2100, before tm_mday may take us across it
+    */
+    if (days > MARCH_2100)
+        days--;
 
-        /*
-         * n is now an index into a group of alternating 31 and 30
-         * day months... 61 day pairs.
-         */
-        m = n / 2;
-        m *= 61;
-        d += m;
+    days += timeptr->tm_mday - 1;       /* tm_mday is one based */
 
-        /*
-         * if n is odd, we are in the second half of the
-         * month pair
-         */
-        if (n & 1)
-            d += 31;
-    }
-
-    /* Add day of year to elapsed days, and convert to seconds */
-    tmp += d;
+    /* convert to seconds */
+    tmp = days - MARCH_1996;
     tmp *= ONE_DAY;
-    ret = tmp;
 
-    /* compute 'fractional' day */
-    tmp = timeptr->tm_hour;
-    tmp *= ONE_HOUR;
+    /* add the 'fractional' day */
+    tmp += timeptr->tm_hour * (uint32_t) ONE_HOUR;
     tmp += timeptr->tm_min * 60UL;
     tmp += timeptr->tm_sec;
 
-    ret += tmp;
-
-    return ret;
+    return tmp;
 }
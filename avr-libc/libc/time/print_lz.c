@@ -30,14 +30,14 @@
 
 /* print 2 digit integer with leading zero: auxillary function for isotime and asctime */
 
-#include <stdlib.h>
+#include <util/divmod.h>
 
 void
 __print_lz(int i, char *buffer, char s)
 {
-    div_t result;
+    udiv8_t result;
 
-    result = div(i, 10);
+    result = udivmod8_10(i);
 
 	*buffer++ = result.quot + '0';
 	*buffer++ = result.rem + '0';
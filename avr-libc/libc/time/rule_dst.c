@@ -0,0 +1,167 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE. */
+
+/* $Id$ */
+
+/*
+	Daylight Saving function driven by the rules of set_dst_rules(). The two
+	transitions of a year are computed once, along with the interval of time
+	over which the result does not change. Later calls within that interval
+	only compare the time stamp with its ends.
+*/
+
+#include <time.h>
+#include <inttypes.h>
+#include <util/divmod.h>
+
+struct dst_rules __dst_rules;
+
+/* the cached interval [__dst_lo, __dst_hi), valid for zone __dst_zone */
+time_t          __dst_lo;
+time_t          __dst_hi;
+int32_t         __dst_zone;
+int16_t         __dst_value;
+
+/* The UTC time stamp of a transition in a year, given the time zone z. */
+static time_t
+transition(int16_t year, const struct dst_rule * rule, int32_t z)
+{
+	struct tm       tm;
+	time_t          t;
+	uint8_t         mday, wday;
+
+	/* the first of the month, and its day of week (the epoch was a Saturday) */
+	tm.tm_year = year;
+	tm.tm_mon = rule->month;
+	tm.tm_mday = 1;
+	tm.tm_hour = 0;
+	tm.tm_min = 0;
+	tm.tm_sec = 0;
+	t = mk_gmtime(&tm);
+	wday = udivmod16_7(udivmod32_86400(t).quot + SATURDAY).rem;
+
+	/* the first requested day of week, then the requested week */
+	mday = rule->wday + 7 - wday;
+	if (mday >= 7)
+		mday -= 7;
+	if (rule->week < 5) {
+		mday += 7 * (rule->week - 1);
+	} else {
+		mday += 21;
+		if (mday + 7 < month_length(year + 1900, rule->month + 1))
+			mday += 7;
+	}
+
+	return t + mday * ONE_DAY + rule->hour * (uint32_t) ONE_HOUR - z;
+}
+
+int
+rule_dst(const time_t * timer, int32_t * z)
+{
+	struct tm       tm;
+	time_t          t, lt, begin, end;
+
+	t = *timer;
+	if (t >= __dst_lo && t < __dst_hi && *z == __dst_zone)
+		return __dst_value;
+
+	/* the year, in local standard time, kept within the range of time_t */
+	lt = t + *z;
+	if (*z < 0 && lt > t)
+		lt = 0;
+	else if (*z > 0 && lt < t)
+		lt = 0xffffffff;
+	gmtime_r(&lt, &tm);
+
+	begin = transition(tm.tm_year, &__dst_rules.start, *z);
+	end = transition(tm.tm_year, &__dst_rules.end, *z);
+
+	/* the start and end of that year */
+	tm.tm_mon = JANUARY;
+	tm.tm_mday = 1;
+	tm.tm_hour = 0;
+	tm.tm_min = 0;
+	tm.tm_sec = 0;
+	lt = mk_gmtime(&tm);
+	__dst_lo = lt - *z;
+	tm.tm_year++;
+	__dst_hi = mk_gmtime(&tm) - *z;
+	__dst_zone = *z;
+
+	/*
+		Clip the transitions to the range of time_t: one before the epoch
+		has already happened, one after its end never does. Only the
+		first year can begin before the epoch, in a zone East of UTC.
+	*/
+	if (*z > 0 && lt < (time_t) *z) {
+		if (begin >= __dst_lo)
+			begin = 0;
+		if (end >= __dst_lo)
+			end = 0;
+	} else {
+		if (begin < __dst_lo)
+			begin = 0xffffffff;
+		if (end < __dst_lo)
+			end = 0xffffffff;
+	}
+
+	/* clip to the range of time_t, which begins and ends within a year */
+	if (__dst_lo > t)
+		__dst_lo = 0;
+	if (__dst_hi <= t)
+		__dst_hi = 0xffffffff;
+
+	/* narrow the interval to the part of the year containing t */
+	if (__dst_rules.start.month < __dst_rules.end.month) {
+		/* Daylight Saving during the year */
+		__dst_value = 0;
+		if (t < begin) {
+			__dst_hi = begin;
+		} else if (t < end) {
+			__dst_lo = begin;
+			__dst_hi = end;
+			__dst_value = __dst_rules.offset;
+		} else {
+			__dst_lo = end;
+		}
+	} else {
+		/* Daylight Saving over the turn of the year */
+		__dst_value = __dst_rules.offset;
+		if (t < end) {
+			__dst_hi = end;
+		} else if (t < begin) {
+			__dst_lo = end;
+			__dst_hi = begin;
+			__dst_value = 0;
+		} else {
+			__dst_lo = begin;
+		}
+	}
+
+	return __dst_value;
+}
@@ -37,8 +37,20 @@
 
 extern int      (*__dst_ptr) (const time_t *, int32_t *);
 
+extern void     (*__tick_hook) (void);
+
 void
 set_dst(int (*d) (const time_t *, int32_t *))
 {
+	asm             volatile(
+			                   "in __tmp_reg__, __SREG__" "\n\t"
+				                 "cli" "\n\t"
+				 ::
+	);
 	__dst_ptr = d;
+	__tick_hook = 0;
+	asm             volatile(
+			                  "out __SREG__, __tmp_reg__" "\n\t"
+				 ::
+	);
 }
@@ -38,6 +38,8 @@
 #include <time.h>
 extern volatile time_t __system_time;
 
+extern void     (*__tick_hook) (void);
+
 void
 set_system_time(time_t timestamp)
 {
@@ -48,6 +50,7 @@ set_system_time(time_t timestamp)
 				 ::
 	);
 	__system_time = timestamp;
+	__tick_hook = 0;
 	asm             volatile(
 			                  "out __SREG__, __tmp_reg__" "\n\t"
 				 ::
@@ -34,8 +34,20 @@
 
 extern long     __utc_offset;
 
+extern void     (*__tick_hook) (void);
+
 void
 set_zone(long z)
 {
+	asm             volatile(
+			                   "in __tmp_reg__, __SREG__" "\n\t"
+				                 "cli" "\n\t"
+				 ::
+	);
 	__utc_offset = z;
+	__tick_hook = 0;
+	asm             volatile(
+			                  "out __SREG__, __tmp_reg__" "\n\t"
+				 ::
+	);
 }
@@ -44,8 +44,6 @@
 #include <math.h>
 #include "ephemera_common.h"
 
-#define LAG 38520
-
 double
 solar_declination(const time_t * timer)
 {
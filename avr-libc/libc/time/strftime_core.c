@@ -0,0 +1,431 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE. */
+
+/* $Id$ */
+
+/*
+    The engine of strftime(), strftime_P() and fstrftime(). The length of
+    each field is known before it is formatted, so a field goes straight
+    into the destination buffer once there is room for it and the final
+    nul, or through a small scratch area to the stream. Digits come from
+    the divisions by constants of <util/divmod.h>.
+*/
+
+#include <stdio.h>
+#include <time.h>
+#include <avr/pgmspace.h>
+#include <util/divmod.h>
+#include "strftime_core.h"
+
+extern long     __utc_offset;
+
+#ifdef __MEMX
+
+const __memx char strfwkdays[] = "Sunday Monday Tuesday Wednesday Thursday Friday Saturday ";
+const __memx char strfmonths[] = "January February March April May June July August September October November December ";
+#define NAMES   const __memx char
+
+#else
+
+const char      strfwkdays[] = "Sunday Monday Tuesday Wednesday Thursday Friday Saturday ";
+const char      strfmonths[] = "January February March April May June July August September October November December ";
+#define NAMES   const char
+
+#endif
+
+/* A character of the format. */
+static char
+fetch(struct __strf * o, const char *p)
+{
+    return o->flash ? pgm_read_byte(p) : *p;
+}
+
+/* Reserve len characters of output, null when they do not fit. */
+static char    *
+room(struct __strf * o, uint8_t len)
+{
+    if (!o->buffer)
+        return o->scratch;
+    if (o->count + len >= o->limit)
+        return 0;
+    return o->buffer + o->count;
+}
+
+/* Account for the len characters written where room() said. */
+static void
+commit(struct __strf * o, uint8_t len)
+{
+    char           *p;
+
+    o->count += len;
+    if (!o->buffer)
+        for (p = o->scratch; len; len--)
+            putc(*p++, o->stream);
+}
+
+/* Two decimal digits. */
+static char    *
+put2(char *p, uint8_t v)
+{
+    udiv8_t         r;
+
+    r = udivmod8_10(v);
+    *p++ = r.quot + '0';
+    *p++ = r.rem + '0';
+    return p;
+}
+
+/* n decimal digits, with leading zeros. */
+static char    *
+putn(char *p, uint16_t v, uint8_t n)
+{
+    udiv16_t        r;
+    char           *e;
+
+    e = p += n;
+    do {
+        r = udivmod16_10(v);
+        *--p = r.rem + '0';
+        v = r.quot;
+    } while (--n);
+    return e;
+}
+
+/* The number of decimal digits of v, at least n. */
+static uint8_t
+digits(uint16_t v, uint8_t n)
+{
+    uint8_t         i;
+
+    i = 1 + (v >= 10) + (v >= 100) + (v >= 1000) + (v >= 10000);
+    return i > n ? i : n;
+}
+
+/* hh:mm, then :ss if asked */
+static void
+put_time(char *p, const struct tm * timeptr, uint8_t sec)
+{
+    p = put2(p, timeptr->tm_hour);
+    *p++ = ':';
+    p = put2(p, timeptr->tm_min);
+    if (sec) {
+        *p++ = ':';
+        put2(p, timeptr->tm_sec);
+    }
+}
+
+/* The hour on a 12 hour clock, the tens blanked when asked. */
+static void
+put12(char *p, uint8_t hour, uint8_t blank)
+{
+    hour = udivmod8_12(hour).rem;
+    if (hour == 0)
+        hour = 12;
+    put2(p, hour);
+    if (blank && *p == '0')
+        *p = ' ';
+}
+
+size_t
+__strftime(struct __strf * o, const char *pattern, const struct tm * timeptr)
+{
+    NAMES          *names;
+    char           *p;
+    char            c;
+    uint8_t         len, n;
+    int             d, w;
+    uint16_t        v;
+    struct week_date wd;
+
+    for (;;) {
+        c = fetch(o, pattern++);
+        if (c == 0)
+            break;
+
+        if (c != '%') {
+            /* a literal */
+            if (!(p = room(o, 1)))
+                goto full;
+            *p = c;
+            commit(o, 1);
+            continue;
+        }
+
+        c = fetch(o, pattern++);
+        if (c == 'E' || c == 'O')
+            c = fetch(o, pattern++);
+
+        switch (c) {
+        case (0):
+            goto done;
+
+        case ('a'):
+        case ('A'):
+            names = strfwkdays;
+            n = timeptr->tm_wday;
+            goto name;
+
+        case ('b'):
+        case ('h'):
+        case ('B'):
+            names = strfmonths;
+            n = timeptr->tm_mon;
+    name:
+            while (n) {
+                if (*names++ == ' ')
+                    n--;
+            }
+            len = 3;
+            if (c == 'A' || c == 'B')
+                for (len = 0; names[len] != ' '; len++);
+            if (!(p = room(o, len)))
+                goto full;
+            for (n = 0; n < len; n++)
+                p[n] = names[n];
+            break;
+
+        case ('c'):
+            /* asctime_r() writes 24 characters and a nul */
+            len = 24;
+            if (!(p = room(o, len)))
+                goto full;
+            asctime_r(timeptr, p);
+            break;
+
+        case ('C'):
+            v = udivmod16_100(timeptr->tm_year + 1900).quot;
+            goto two;
+
+        case ('d'):
+            v = timeptr->tm_mday;
+            goto two;
+
+        case ('D'):
+        case ('x'):
+            len = 8;
+            if (!(p = room(o, len)))
+                goto full;
+            p = put2(p, timeptr->tm_mon + 1);
+            *p++ = '/';
+            p = put2(p, timeptr->tm_mday);
+            *p++ = '/';
+            put2(p, udivmod16_100(timeptr->tm_year).rem);
+            break;
+
+        case ('e'):
+            len = 2;
+            if (!(p = room(o, len)))
+                goto full;
+            put2(p, timeptr->tm_mday);
+            if (*p == '0')
+                *p = ' ';
+            break;
+
+        case ('F'):
+            v = timeptr->tm_year + 1900;
+            n = digits(v, 1);
+            len = n + 6;
+            if (!(p = room(o, len)))
+                goto full;
+            p = putn(p, v, n);
+            *p++ = '-';
+            p = put2(p, timeptr->tm_mon + 1);
+            *p++ = '-';
+            put2(p, timeptr->tm_mday);
+            break;
+
+        case ('g'):
+        case ('G'):
+        case ('V'):
+            iso_week_date_r(timeptr->tm_year + 1900, timeptr->tm_yday, &wd);
+            v = wd.week;
+            if (c == 'V')
+                goto two;
+            v = wd.year;
+            if (c == 'G') {
+                len = 4;
+                goto number;
+            }
+            v = udivmod16_100(v).rem;
+            goto two;
+
+        case ('H'):
+            v = timeptr->tm_hour;
+            goto two;
+
+        case ('I'):
+            len = 2;
+            if (!(p = room(o, len)))
+                goto full;
+            put12(p, timeptr->tm_hour, 0);
+            break;
+
+        case ('j'):
+            v = timeptr->tm_yday + 1;
+            len = 3;
+            goto number;
+
+        case ('m'):
+            v = timeptr->tm_mon + 1;
+            goto two;
+
+        case ('M'):
+            v = timeptr->tm_min;
+            goto two;
+
+        case ('n'):
+            c = '\n';
+            goto single;
+
+        case ('p'):
+            len = 2;
+            if (!(p = room(o, len)))
+                goto full;
+            p[0] = timeptr->tm_hour > 11 ? 'P' : 'A';
+            p[1] = 'M';
+            break;
+
+        case ('r'):
+            len = 11;
+            if (!(p = room(o, len)))
+                goto full;
+            put12(p, timeptr->tm_hour, 1);
+            p[2] = ':';
+            put2(p + 3, timeptr->tm_min);
+            p[5] = ':';
+            put2(p + 6, timeptr->tm_sec);
+            p[8] = ' ';
+            p[9] = timeptr->tm_hour > 11 ? 'P' : 'A';
+            p[10] = 'M';
+            break;
+
+        case ('R'):
+            len = 5;
+            if (!(p = room(o, len)))
+                goto full;
+            put_time(p, timeptr, 0);
+            break;
+
+        case ('S'):
+            v = timeptr->tm_sec;
+            goto two;
+
+        case ('t'):
+            c = '\t';
+            goto single;
+
+        case ('T'):
+        case ('X'):
+            len = 8;
+            if (!(p = room(o, len)))
+                goto full;
+            put_time(p, timeptr, 1);
+            break;
+
+        case ('u'):
+            v = timeptr->tm_wday;
+            if (v == 0)
+                v = 7;
+            len = 1;
+            goto number;
+
+        case ('U'):
+            v = week_of_year(timeptr, 0);
+            goto two;
+
+        case ('w'):
+            v = timeptr->tm_wday;
+            len = 1;
+            goto number;
+
+        case ('W'):
+            v = week_of_year(timeptr, 1);
+            goto two;
+
+        case ('y'):
+            v = udivmod16_100(timeptr->tm_year).rem;
+            goto two;
+
+        case ('Y'):
+            v = timeptr->tm_year + 1900;
+            len = 1;
+            goto number;
+
+        case ('z'):
+            d = __utc_offset / 60;
+            w = timeptr->tm_isdst / 60;
+            if (w > 0)
+                d += w;
+            len = 5;
+            if (!(p = room(o, len)))
+                goto full;
+            *p++ = '+';
+            if (d < 0) {
+                p[-1] = '-';
+                d = -d;
+            }
+            p = put2(p, udivmod16_60(d).quot);
+            put2(p, udivmod16_60(d).rem);
+            break;
+
+        case ('%'):
+            goto single;
+
+        default:
+            c = '?';
+    single:
+            len = 1;
+            if (!(p = room(o, len)))
+                goto full;
+            *p = c;
+            break;
+
+    two:
+            len = 2;
+    number:
+            len = digits(v, len);
+            if (!(p = room(o, len)))
+                goto full;
+            putn(p, v, len);
+            break;
+        }
+
+        commit(o, len);
+    }
+
+done:
+    if (o->buffer && o->limit)
+        o->buffer[o->count] = 0;
+    return o->count;
+
+full:
+    /* the buffer is too small, there is room for the nul if any */
+    if (o->limit)
+        o->buffer[o->count] = 0;
+    return 0;
+}
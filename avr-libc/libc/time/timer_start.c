@@ -0,0 +1,60 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE. */
+
+/* $Id$ */
+
+/*
+	Start, or restart, a timer to expire at the given tick from now.
+*/
+
+#include "timer_wheel.h"
+
+void
+timer_start(struct timer * t, uint16_t ticks, void (*callback) (struct timer *))
+{
+	uint8_t         sreg;
+
+	/* expiring at the next tick is the earliest */
+	if (ticks)
+		ticks--;
+
+	asm             volatile(
+			                 "in %0, __SREG__" "\n\t"
+			                 "cli"
+			 : "=r"(sreg) :: "memory"
+	);
+	if (t->pprev)
+		__timer_unlink(t);
+	t->callback = callback;
+	t->rounds = ticks >> WHEEL_BITS;
+	__timer_link(&__timer_wheel[(__timer_cursor + 1 + ticks) & WHEEL_MASK], t);
+	asm             volatile(
+			                 "out __SREG__, %0"
+			 :: "r"(sreg) : "memory"
+	);
+}
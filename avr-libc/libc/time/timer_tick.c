@@ -0,0 +1,81 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE. */
+
+/* $Id$ */
+
+/*
+	Advance the timer wheel by one slot. Timers of that slot with turns left
+	lose one, the others move to a private list, from which they are taken
+	one at a time to call their callback. A callback may thus start or stop
+	any timer, including those still waiting on the private list.
+*/
+
+#include "timer_wheel.h"
+
+void
+timer_tick(void)
+{
+	struct timer   *t, *next, *expired;
+	uint8_t         sreg;
+
+	asm             volatile(
+			                 "in %0, __SREG__" "\n\t"
+			                 "cli"
+			 : "=r"(sreg) :: "memory"
+	);
+
+	__timer_cursor = (__timer_cursor + 1) & WHEEL_MASK;
+	expired = 0;
+	for (t = __timer_wheel[__timer_cursor]; t; t = next) {
+		next = t->next;
+		if (t->rounds) {
+			t->rounds--;
+		} else {
+			__timer_unlink(t);
+			__timer_link(&expired, t);
+		}
+	}
+
+	while ((t = expired) != 0) {
+		__timer_unlink(t);
+		asm             volatile(
+				                 "out __SREG__, %0"
+				 :: "r"(sreg) : "memory"
+		);
+		t->callback(t);
+		asm             volatile(
+				                 "cli"
+				 ::: "memory"
+		);
+	}
+
+	asm             volatile(
+			                 "out __SREG__, %0"
+			 :: "r"(sreg) : "memory"
+	);
+}
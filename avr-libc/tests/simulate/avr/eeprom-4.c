@@ -0,0 +1,93 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE. */
+
+/* Test of background EEPROM writes.
+   $Id$	*/
+
+#include <avr/eeprom.h>
+#include <avr/interrupt.h>
+#include <stdlib.h>
+
+#if	defined (__AVR_XMEGA__) && __AVR_XMEGA__
+
+int main ()
+{
+    return 0;
+}
+
+#else
+
+static volatile unsigned char done;
+
+static void count (void)
+{
+    done++;
+}
+
+int main ()
+{
+    unsigned char s[40];
+    unsigned char i;
+
+    /* Fill the start of EEPROM.	*/
+    for (i = 0; i < sizeof (s) + 8; i++)
+	eeprom_write_byte ((unsigned char *)(int)i, 0xff);
+    for (i = 0; i < sizeof (s); i++)
+	s[i] = i + 1;
+
+    sei ();
+    if (eeprom_async_busy ()) exit (__LINE__);
+    if (eeprom_write_async (s, (void *)0, 20, count)) exit (__LINE__);
+    if (eeprom_write_async (s + 20, (void *)20, 20, count)) exit (__LINE__);
+    if (eeprom_write_async (s, (void *)40, 0, 0)) exit (__LINE__);
+    if (eeprom_write_async (s, (void *)40, 1, count)) exit (__LINE__);
+    if (eeprom_write_async (s, (void *)41, 1, count) != -1) exit (__LINE__);
+    if (!eeprom_async_busy ()) exit (__LINE__);
+
+    while (eeprom_async_busy ())
+	;
+    if (done != 3) exit (__LINE__);
+    if (!eeprom_is_ready ()) exit (__LINE__);
+
+    for (i = 0; i < sizeof (s); i++) {
+	if (eeprom_read_byte ((unsigned char *)(int)i) != i + 1)
+	    exit (__LINE__);
+    }
+    if (eeprom_read_byte ((unsigned char *)40) != 1) exit (__LINE__);
+    if (eeprom_read_byte ((unsigned char *)41) != 0xff) exit (__LINE__);
+
+    /* The same data again: nothing to write.	*/
+    if (eeprom_write_async (s, (void *)0, sizeof (s), count)) exit (__LINE__);
+    while (eeprom_async_busy ())
+	;
+    if (done != 4) exit (__LINE__);
+
+    return 0;
+}
+
+#endif
@@ -0,0 +1,57 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE. */
+
+/* Test of the write and update functions over the old values which
+   select erase only, write only, and erase and write programming.
+   $Id$	*/
+
+#include <avr/eeprom.h>
+#include <stdlib.h>
+
+static const unsigned char old[] = { 0x00, 0x55, 0xF5, 0xFF, 0x0F, 0xFF };
+static const unsigned char new[] = { 0xFF, 0x05, 0x55, 0x3C, 0xF0, 0xFF };
+
+int main ()
+{
+    unsigned char i;
+    unsigned char *p;
+
+    for (i = 0; i < sizeof (old); i++) {
+	p = (unsigned char *)(int)i;
+
+	eeprom_write_byte (p, old[i]);
+	eeprom_write_byte (p, new[i]);
+	if (eeprom_read_byte (p) != new[i]) exit (__LINE__);
+
+	eeprom_write_byte (p, old[i]);
+	eeprom_update_byte (p, new[i]);
+	if (eeprom_read_byte (p) != new[i]) exit (__LINE__);
+    }
+
+    return 0;
+}
@@ -0,0 +1,73 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE. */
+
+/* Test of the wear leveling ring of records.
+   $Id$	*/
+
+#include <avr/eeprom.h>
+#include <stdlib.h>
+
+#define SLOTS	5
+
+int main ()
+{
+    struct eeprom_ring r;
+    unsigned long v, i;
+    unsigned char *p;
+
+    /* Erased EEPROM: no record.	*/
+    for (p = 0; p < (unsigned char *) EEPROM_RING_SIZE (sizeof (v), SLOTS); p++)
+	eeprom_write_byte (p, 0xff);
+    if (eeprom_ring_init (&r, 0, sizeof (v), SLOTS) != 0) exit (__LINE__);
+    if (eeprom_ring_read (&r, &v) != -1) exit (__LINE__);
+
+    /* Write around the ring a few times, find the newest each time.	*/
+    for (i = 1; i <= 3 * SLOTS + 2; i++) {
+	v = i * 1000;
+	eeprom_ring_write (&r, &v);
+	v = 0;
+	if (eeprom_ring_init (&r, 0, sizeof (v), SLOTS) != 1) exit (__LINE__);
+	if (eeprom_ring_read (&r, &v) || v != i * 1000) exit (__LINE__);
+	if (r.newest != (i - 1) % SLOTS) exit (__LINE__);
+    }
+
+    /* A damaged newest record: the one before it is found.	*/
+    p = (unsigned char *)(r.newest * EEPROM_RING_SLOT (sizeof (v)) + 3);
+    eeprom_write_byte (p, ~eeprom_read_byte (p));
+    if (eeprom_ring_init (&r, 0, sizeof (v), SLOTS) != 1) exit (__LINE__);
+    if (eeprom_ring_read (&r, &v) || v != (i - 2) * 1000) exit (__LINE__);
+
+    /* The next write goes over the damaged one.	*/
+    v = 12345;
+    eeprom_ring_write (&r, &v);
+    if (eeprom_ring_init (&r, 0, sizeof (v), SLOTS) != 1) exit (__LINE__);
+    if (eeprom_ring_read (&r, &v) || v != 12345) exit (__LINE__);
+    if (r.newest != (i - 2) % SLOTS) exit (__LINE__);
+
+    return 0;
+}
@@ -0,0 +1,150 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Test of bsearch_P(), bsearch_PF() and the isearch_*_P[F]()
+   functions.
+   $Id$	*/
+
+#ifndef __AVR__
+
+/* The functions are AVR-libc extensions.	*/
+int main ()	{ return 0; }
+
+#else
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <avr/pgmspace.h>
+
+struct cal {
+    char name[4];
+    int val;
+};
+
+static const struct cal cal[] PROGMEM = {
+    { "abc", 1 }, { "abd", 2 }, { "b", 3 }, { "cx", 4 }, { "zzz", 5 },
+};
+
+/* Uneven on purpose: a flat run, a jump and a repeated value.	*/
+static const uint16_t t16[] PROGMEM = {
+    10, 20, 30, 40, 50, 60, 70, 80, 90, 100,
+    100, 100, 100, 100, 2000, 2001, 2002, 2500, 60000, 65535,
+};
+
+static const uint32_t t32[] PROGMEM = {
+    0, 1000, 2000, 3000, 4000, 100000, 100001, 4000000000,
+};
+
+static int cmp_P (const void *key, const void *p)
+{
+    return strcmp_P (key, ((const struct cal *) p)->name);
+}
+
+static int cmp_PF (const void *key, uint_farptr_t p)
+{
+    return strcmp_PF (key, p + offsetof (struct cal, name));
+}
+
+#define N16	(sizeof (t16) / sizeof (t16[0]))
+#define N32	(sizeof (t32) / sizeof (t32[0]))
+
+/* Number of elements not greater than the key, the slow way.	*/
+static size_t count16 (uint16_t key, size_t n)
+{
+    size_t i = 0;
+    while (i < n && pgm_read_word (t16 + i) <= key)
+	i++;
+    return i;
+}
+
+static size_t count32 (uint32_t key, size_t n)
+{
+    size_t i = 0;
+    while (i < n && pgm_read_dword (t32 + i) <= key)
+	i++;
+    return i;
+}
+
+int main ()
+{
+    static const char *const names[] = { "abc", "abd", "b", "cx", "zzz" };
+    uint_farptr_t far = pgm_get_far_address (cal);
+    const struct cal *p;
+    uint32_t k32;
+    size_t i, n;
+    int k;
+
+    for (i = 0; i < 5; i++) {
+	p = bsearch_P (names[i], cal, 5, sizeof (cal[0]), cmp_P);
+	if (p != cal + i || pgm_read_word (&p->val) != (int) i + 1)
+	    exit (__LINE__);
+	if (bsearch_PF (names[i], far, 5, sizeof (cal[0]), cmp_PF)
+	    != far + i * sizeof (cal[0]))
+	    exit (__LINE__);
+    }
+    if (bsearch_P ("abcd", cal, 5, sizeof (cal[0]), cmp_P)
+	|| bsearch_P ("a", cal, 5, sizeof (cal[0]), cmp_P)
+	|| bsearch_P ("zzzz", cal, 5, sizeof (cal[0]), cmp_P)
+	|| bsearch_P ("abc", cal, 0, sizeof (cal[0]), cmp_P))
+	exit (__LINE__);
+    if (bsearch_PF ("c", far, 5, sizeof (cal[0]), cmp_PF))
+	exit (__LINE__);
+
+    for (n = 0; n <= N16; n++) {
+	for (k = 0; k < 40; k++) {
+	    uint16_t key = k < 20 ? pgm_read_word (t16 + k) : k * 1700U;
+	    size_t e = count16 (key, n);
+	    if (isearch_u16_P (key, t16, n) != e
+		|| isearch_u16_PF (key, pgm_get_far_address (t16), n) != e)
+		exit (__LINE__);
+	    key -= 1;
+	    e = count16 (key, n);
+	    if (isearch_u16_P (key, t16, n) != e)
+		exit (__LINE__);
+	}
+    }
+
+    for (n = 0; n <= N32; n++) {
+	for (k = 0; k < 30; k++) {
+	    k32 = k < 8 ? pgm_read_dword (t32 + k) : k * 150000000UL;
+	    if (isearch_u32_P (k32, t32, n) != count32 (k32, n)
+		|| isearch_u32_PF (k32, pgm_get_far_address (t32), n)
+		   != count32 (k32, n))
+		exit (__LINE__);
+	    k32 += 1;
+	    if (isearch_u32_P (k32, t32, n) != count32 (k32, n))
+		exit (__LINE__);
+	}
+    }
+
+    return 0;
+}
+
+#endif
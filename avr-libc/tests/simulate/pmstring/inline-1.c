@@ -0,0 +1,93 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Test of memcpy_P(), memcmp_P() and memcmp() with a small constant
+   size, which are expanded inline when optimizing.
+   $Id$	*/
+
+#ifndef __AVR__
+
+/* The inline expansion is AVR specific.	*/
+int main ()
+{
+    return 0;
+}
+
+#else
+
+#include <stdlib.h>
+#include <string.h>
+#include <avr/pgmspace.h>
+
+static const unsigned char pgm[8] PROGMEM = {
+    1, 2, 3, 0x80, 0xff, 6, 7, 8
+};
+
+volatile size_t vn = 8;
+
+int main ()
+{
+    unsigned char s[9];
+
+    memset (s, 0x55, sizeof (s));
+    if (memcpy_P (s, pgm, 5) != s)
+	exit (__LINE__);
+    if (s[0] != 1 || s[3] != 0x80 || s[4] != 0xff || s[5] != 0x55)
+	exit (__LINE__);
+    if (memcpy_P (s, pgm, 8) != s || s[7] != 8 || s[8] != 0x55)
+	exit (__LINE__);
+
+    /* The difference of the first mismatching bytes is returned.	*/
+    if (memcmp_P (s, pgm, 8) || memcmp_P (s, pgm, 0))
+	exit (__LINE__);
+    s[4] = 0xfe;
+    if (memcmp_P (s, pgm, 4) != 0 || memcmp_P (s, pgm, 5) != -1)
+	exit (__LINE__);
+    s[3] = 0x81;
+    if (memcmp_P (s, pgm, 8) != 1)
+	exit (__LINE__);
+    s[0] = 0;
+    if (memcmp_P (s, pgm, 1) != -1)
+	exit (__LINE__);
+    if (memcmp_P (s, pgm, vn) != -1)
+	exit (__LINE__);
+
+    if (memcmp (s, s + 1, 0) || memcmp (s + 3, "\201\376", 2))
+	exit (__LINE__);
+    if (memcmp (s + 3, "\201\377", 2) != -1)
+	exit (__LINE__);
+    if (memcmp (s + 1, "\001", 1) != 1)
+	exit (__LINE__);
+    if (memcmp (s, "\001", vn - 7) != -1)
+	exit (__LINE__);
+
+    return 0;
+}
+
+#endif
@@ -0,0 +1,113 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Test of the far pointer search functions: memchr_PF(), memrchr_PF(),
+   strchr_PF(), strrchr_PF(), strspn_PF(), strcspn_PF(), strpbrk_PF(),
+   strsep_PF(), strtok_rPF(), memmem_PF() and memccpy_PF().
+   $Id$	*/
+
+#ifndef __AVR__
+
+/* Omit the test.	*/
+int main ()	{ return 0; }
+
+#else
+
+#include <stdlib.h>
+#include <string.h>
+#include <avr/pgmspace.h>
+
+static const char text[] PROGMEM = "the quick brown fox";
+static const char dlm1[] PROGMEM = " ";
+static const char dlms[] PROGMEM = " ,;:.!?";
+
+int main ()
+{
+    uint_farptr_t t = pgm_get_far_address (text);
+    uint_farptr_t d1 = pgm_get_far_address (dlm1);
+    uint_farptr_t ds = pgm_get_far_address (dlms);
+    char s[32];
+    char *p, *last;
+
+    /* Flash side searches: the result is a far pointer.	*/
+    if (memchr_PF (t, 'q', sizeof (text)) != t + 4
+	|| memchr_PF (t, 'q', 4) != 0)
+	exit (__LINE__);
+    if (memrchr_PF (t, 'o', sizeof (text)) != t + 17
+	|| memrchr_PF (t, 'o', 12) != 0)
+	exit (__LINE__);
+    if (strchr_PF (t, 'o') != t + 12 || strchr_PF (t, 0) != t + 19
+	|| strchr_PF (t, 'z') != 0)
+	exit (__LINE__);
+    if (strrchr_PF (t, ' ') != t + 15 || strrchr_PF (t, 'z') != 0)
+	exit (__LINE__);
+
+    /* Sets in flash: short and long ones.	*/
+    strcpy (s, "  ab, cd;e");
+    if (strspn_PF (s, d1) != 2 || strspn_PF (s, ds) != 2)
+	exit (__LINE__);
+    if (strcspn_PF (s + 2, d1) != 3 || strcspn_PF (s + 2, ds) != 2)
+	exit (__LINE__);
+    if (strpbrk_PF (s + 2, ds) != s + 4 || strpbrk_PF ("abc", ds))
+	exit (__LINE__);
+
+    p = s + 2;
+    if (strsep_PF (&p, ds) != s + 2 || p != s + 5 || strcmp (s + 2, "ab"))
+	exit (__LINE__);
+
+    strcpy (s, "  ab, cd;e");
+    p = strtok_rPF (s, ds, &last);
+    if (p != s + 2 || strcmp (p, "ab"))
+	exit (__LINE__);
+    p = strtok_rPF (0, ds, &last);
+    if (p != s + 6 || strcmp (p, "cd"))
+	exit (__LINE__);
+    p = strtok_PF (s + 9, d1);
+    if (p != s + 9 || strcmp (p, "e") || strtok_PF (0, d1))
+	exit (__LINE__);
+    if (strtok_rPF (0, ds, &last) != s + 9 || strtok_rPF (0, ds, &last))
+	exit (__LINE__);
+
+    /* memmem_PF, memccpy_PF	*/
+    strcpy (s, "a quick fox");
+    if (memmem_PF (s, strlen (s), t + 4, 5) != s + 2
+	|| memmem_PF (s, strlen (s), t + 16, 4) != 0
+	|| memmem_PF (s, 3, t + 4, 5) != 0)
+	exit (__LINE__);
+    memset (s, 'x', sizeof (s));
+    if (memccpy_PF (s, t, 'k', sizeof (text)) != s + 9
+	|| memcmp (s, "the quickx", 10))
+	exit (__LINE__);
+    if (memccpy_PF (s, t, 'z', 5) != 0)
+	exit (__LINE__);
+
+    return 0;
+}
+
+#endif	/* __AVR__ */
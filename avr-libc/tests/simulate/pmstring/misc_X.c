@@ -0,0 +1,79 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Test of the __memx string functions: strlen_X(), strchr_X(),
+   memcpy_X(), strcpy_X(), strcmp_X(), strncmp_X() and memcmp_X().
+   $Id$	*/
+
+#if !defined(__AVR__) || !defined(__MEMX)
+
+/* Omit the test.	*/
+int main ()	{ return 0; }
+
+#else
+
+#include <stdlib.h>
+#include <string.h>
+#include <avr/pgmspace.h>
+
+static const __memx char flash_str[] = "hello, world";
+static char ram_str[] = "hello, world";
+
+static void check (const __memx char *p, int line)
+{
+    char buf[16];
+
+    if (strlen_X (p) != 12)
+	exit (line);
+    if (strchr_X (p, 'w') != p + 7 || strchr_X (p, 0) != p + 12
+	|| strchr_X (p, 'z') != 0)
+	exit (line);
+    memset (buf, 'x', sizeof (buf));
+    if (memcpy_X (buf, p, 5) != buf || memcmp (buf, "hellox", 6))
+	exit (line);
+    if (strcpy_X (buf, p) != buf || strcmp (buf, "hello, world"))
+	exit (line);
+    if (strcmp_X ("hello, world", p) != 0 || strcmp_X ("hello", p) >= 0
+	|| strcmp_X ("help", p) <= 0)
+	exit (line);
+    if (strncmp_X ("hello, there", p, 7) != 0
+	|| strncmp_X ("hello, there", p, 8) >= 0)
+	exit (line);
+    if (memcmp_X ("hello!", p, 5) != 0 || memcmp_X ("hello!", p, 6) <= 0)
+	exit (line);
+}
+
+int main ()
+{
+    check (flash_str, __LINE__);
+    check (ram_str, __LINE__);
+    return 0;
+}
+
+#endif
@@ -0,0 +1,80 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Test of the program memory cursor: pgm_cursor_init(), pgm_cursor_getc(),
+   pgm_cursor_read() and pgm_cursor_tell().
+   $Id$	*/
+
+#ifndef __AVR__
+
+/* Omit the test.	*/
+int main ()	{ return 0; }
+
+#else
+
+#include <stdlib.h>
+#include <string.h>
+#include <avr/pgmspace.h>
+
+static const unsigned char table[] PROGMEM = {
+    1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 0xff, 0
+};
+
+int main ()
+{
+    pgm_cursor_t c;
+    uint_farptr_t t = pgm_get_far_address (table);
+    unsigned char buf[20];
+    unsigned char i;
+
+    pgm_cursor_init (&c, t);
+    for (i = 0; i < sizeof (table); i++) {
+	if (pgm_cursor_tell (&c) != t + i)
+	    exit (__LINE__);
+	if (pgm_cursor_getc (&c) != pgm_read_byte (&table[i]))
+	    exit (__LINE__);
+    }
+
+    pgm_cursor_init (&c, t);
+    memset (buf, 0xaa, sizeof (buf));
+    pgm_cursor_read (&c, buf, 0);
+    pgm_cursor_read (&c, buf, 5);
+    if (pgm_cursor_tell (&c) != t + 5 || memcmp_P (buf, table, 5)
+	|| buf[5] != 0xaa)
+	exit (__LINE__);
+    pgm_cursor_read (&c, buf + 5, sizeof (table) - 6);
+    if (pgm_cursor_getc (&c) != 0 || memcmp_P (buf, table, sizeof (table) - 1))
+	exit (__LINE__);
+    if (pgm_cursor_tell (&c) != t + sizeof (table))
+	exit (__LINE__);
+
+    return 0;
+}
+
+#endif
@@ -167,6 +167,7 @@ Compile ()
 	    atmega8)    avrno=4 ; crt=crtm8.o ;;
 	    atmega16)   avrno=5 ; crt=crtm16.o ;;
 	    atmega128)  avrno=5 ; crt=crtm128.o ;;
+	    at90can32)  avrno=5 ; crt=crtcan32.o ;;
 	    *)
 		Errx "Compile(): invalid MCU: $2"
 	esac
@@ -209,6 +210,13 @@ Compile ()
 	    libs="$AVRDIR/avr/lib/avr$avrno/libscanf_flt.a $libs"
 	fi
 	;;
+      LC_FAST)
+	if [ -z "$AVRDIR" ] ; then
+	    libs="-lc_fast $libs"
+	else
+	    libs="$AVRDIR/avr/lib/avr$avrno/libc_fast.a $libs"
+	fi
+	;;
     esac
 
     # The GCC 4.1 (and older) does not define __ASSEMBLER__ with
@@ -262,6 +270,7 @@ for test_file in $test_list ; do
 		    *scanf_flt*)	prlist="SC_FLT" ;;
 		    *scanf_brk*)	prlist="SC_STD SC_FLT" ;;
 		    *scanf*)		prlist="SC_STD SC_FLT SC_MIN" ;;
+		    *_fast*)		prlist="PR_STD LC_FAST" ;;
 		    *)			prlist="PR_STD" ;;
 		esac
 
@@ -270,6 +279,11 @@ for test_file in $test_list ; do
 		    *)    mcu_list="$MCU_LIST" ;;
 		esac
 
+		# AT90CAN32 has RAMPZ, but no ELPM.
+		case $rootname in
+		    pgm_cursor)	mcu_list="$mcu_list at90can32" ;;
+		esac
+
 	        elf_file=$rootname.elf
 		for prvers in $prlist ; do
 		    for mcu in $mcu_list ; do
@@ -279,6 +293,7 @@ for test_file in $test_list ; do
 			    PR_FLT)	echo -n "/printf_flt " ;;
 			    SC_MIN)	echo -n "/scanf_min " ;;
 			    SC_FLT)	echo -n "/scanf_flt " ;;
+			    LC_FAST)	echo -n "/c_fast " ;;
 			esac
 			echo -n "$mcu ... "
 		        if ! Compile $test_file $mcu $elf_file $prvers
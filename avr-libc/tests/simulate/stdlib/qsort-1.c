@@ -0,0 +1,98 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Test of qsort(): element sizes with and without a fast swap, input
+   orders which take each path of the sort.
+   $Id$	*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#define N	60
+
+static unsigned char buf[N * 4];
+static size_t es;
+
+/* The key is the first byte of an element, the rest is its payload.  */
+static int cmp (const void *p1, const void *p2)
+{
+    return *(const unsigned char *) p1 - *(const unsigned char *) p2;
+}
+
+static unsigned char key (int order, int i, int n)
+{
+    switch (order) {
+	case 0:  return rand ();
+	case 1:  return i;			/* sorted	*/
+	case 2:  return n - i;			/* reversed	*/
+	case 3:  return 7;			/* all equal	*/
+	case 4:  return rand () & 3;		/* few values	*/
+	case 5:  return i < n / 2 ? i : n - i;	/* organ pipe	*/
+	default: return (i & 1) ? i : n + i / 2;
+    }
+}
+
+static void check (int order, int n)
+{
+    unsigned int sum = 0;
+    int i;
+    size_t k;
+
+    for (i = 0; i < n; i++) {
+	buf[i * es] = key (order, i, n);
+	/* The payload is a checksum of the key, it must move with it.	*/
+	for (k = 1; k < es; k++)
+	    buf[i * es + k] = buf[i * es] ^ (0x5a + k);
+	sum += buf[i * es];
+    }
+
+    qsort (buf, n, es, cmp);
+
+    for (i = 0; i < n; i++) {
+	if (i && buf[(i - 1) * es] > buf[i * es])
+	    exit (__LINE__);
+	for (k = 1; k < es; k++)
+	    if (buf[i * es + k] != (buf[i * es] ^ (0x5a + k)))
+		exit (__LINE__);
+	sum -= buf[i * es];
+    }
+    if (sum)
+	exit (__LINE__);
+}
+
+int main ()
+{
+    int order, n;
+
+    for (es = 1; es <= 4; es++)
+	for (order = 0; order < 7; order++)
+	    for (n = 0; n <= N; n += (n < 10 ? 1 : 10))
+		check (order, n);
+    return 0;
+}
@@ -0,0 +1,114 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Test of radixsort_u8(), radixsort_u16() and radixsort_u32().
+   $Id$	*/
+
+#ifndef __AVR__
+
+/* The functions are AVR-libc extensions.	*/
+int main ()	{ return 0; }
+
+#else
+
+#include <stdlib.h>
+#include <string.h>
+
+#define N	20
+
+static union {
+    unsigned char u8[N];
+    unsigned int u16[N];
+    unsigned long u32[N];
+} u;
+static unsigned int data[N];
+static unsigned char tmp[N * 6];
+
+static unsigned long key (int kind, int i)
+{
+    switch (kind) {
+	case 0:  return random ();
+	case 1:  return random () & 0x3ff;	/* 10-bit samples	*/
+	case 2:  return N - i;
+	case 3:  return 0x55aa55aa;
+	default: return random () & 0x30003;	/* ties		*/
+    }
+}
+
+int main ()
+{
+    unsigned long k[N];
+    int kind, n, i;
+
+    for (kind = 0; kind < 5; kind++) {
+	for (n = 0; n <= N; n += (n < 4 ? 1 : 8)) {
+	    for (i = 0; i < n; i++) {
+		k[i] = key (kind, i);
+		data[i] = i;
+	    }
+
+	    for (i = 0; i < n; i++)
+		u.u8[i] = k[i];
+	    radixsort_u8 (u.u8, n, tmp, 0);
+	    for (i = 1; i < n; i++)
+		if (u.u8[i - 1] > u.u8[i])
+		    exit (__LINE__);
+
+	    for (i = 0; i < n; i++)
+		u.u16[i] = k[i];
+	    radixsort_u16 (u.u16, n, tmp, data);
+	    for (i = 0; i < n; i++) {
+		if (u.u16[i] != (unsigned int) k[data[i]])
+		    exit (__LINE__);
+		/* Stable: equal keys keep their order.	*/
+		if (i && (u.u16[i - 1] > u.u16[i]
+			  || (u.u16[i - 1] == u.u16[i]
+			      && data[i - 1] > data[i])))
+		    exit (__LINE__);
+	    }
+
+	    for (i = 0; i < n; i++) {
+		u.u32[i] = k[i];
+		data[i] = i;
+	    }
+	    radixsort_u32 (u.u32, n, tmp, data);
+	    for (i = 0; i < n; i++) {
+		if (u.u32[i] != k[data[i]])
+		    exit (__LINE__);
+		if (i && (u.u32[i - 1] > u.u32[i]
+			  || (u.u32[i - 1] == u.u32[i]
+			      && data[i - 1] > data[i])))
+		    exit (__LINE__);
+	    }
+	}
+    }
+    return 0;
+}
+
+#endif
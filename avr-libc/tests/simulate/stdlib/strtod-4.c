@@ -0,0 +1,108 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Test of strtod() function. Short decimals, which must be converted
+   with correct rounding.
+   $Id$
+ */
+#include <errno.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "progmem.h"
+
+union lofl_u {
+    long lo;
+    float fl;
+};
+
+volatile union lofl_u v = { .lo = 1 };
+
+PROGMEM const struct {		/* Table of test cases.	*/
+    char s[20];
+    unsigned char len;
+    union lofl_u val;
+} t[] = {
+
+    { "0.1", 3,			{ .fl = 0.1f } },
+    { "0.2", 3,			{ .fl = 0.2f } },
+    { "0.3", 3,			{ .fl = 0.3f } },
+    { "-0.7", 4,		{ .fl = -0.7f } },
+    { "3.14159", 7,		{ .fl = 3.14159f } },
+    { "2.718282", 8,		{ .fl = 2.718282f } },
+    { "123.456", 7,		{ .fl = 123.456f } },
+    { "0.0001", 6,		{ .fl = 0.0001f } },
+    { "9.999999", 8,		{ .fl = 9.999999f } },
+    { "16777216e-10", 12,	{ .fl = 16777216e-10f } },
+    { "1677.7215", 9,		{ .fl = 1677.7215f } },
+    { "1e-10", 5,		{ .fl = 1e-10f } },
+    { "5e10", 4,		{ .fl = 5e10f } },
+    { "1e15", 4,		{ .fl = 1e15f } },
+    { "12e14", 5,		{ .fl = 12e14f } },
+    { "0.000123e-3", 11,	{ .fl = 0.000123e-3f } },
+    { "1234567e3", 9,		{ .fl = 1234567e3f } },
+    { "25.4", 4,		{ .fl = 25.4f } },
+    { "-273.15", 7,		{ .fl = -273.15f } },
+    { "1013.25", 7,		{ .fl = 1013.25f } },
+    { "0.333333", 8,		{ .fl = 0.333333f } },
+};
+
+void x_exit (int index)
+{
+#ifndef	__AVR__
+    fprintf (stderr, "t[%d]:  %#lx\n", index - 1, v.lo);
+#endif
+    exit (index ? index : -1);
+}
+
+int main ()
+{
+    char s [sizeof(t[0].s)];
+    char *p;
+    union lofl_u mst;
+    unsigned char len;
+    int i;
+
+    for (i = 0; i < (int) (sizeof(t) / sizeof(t[0])); i++) {
+	strcpy_P (s, t[i].s);
+	len = pgm_read_byte (& t[i].len);
+	mst.lo = pgm_read_dword (& t[i].val);
+
+	errno = 0;
+	p = 0;
+	v.fl = strtod (s, &p);
+
+	if (!p || (p - s) != len || errno)
+	    x_exit (i+1);
+	if (v.lo != mst.lo)
+	    x_exit (i+1);
+    }
+    return 0;
+}
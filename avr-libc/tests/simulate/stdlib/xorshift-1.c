@@ -0,0 +1,123 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Test of random16(), random32(), random_fill() and their _r forms.
+   $Id$	*/
+
+#ifndef __AVR__
+
+/* The functions are AVR-libc extensions.	*/
+int main ()	{ return 0; }
+
+#else
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+static uint16_t ref16 (uint16_t x)
+{
+    x ^= x << 7;
+    x ^= x >> 9;
+    x ^= x << 8;
+    return x;
+}
+
+static uint32_t ref32 (uint32_t x)
+{
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return x;
+}
+
+int main ()
+{
+    unsigned int c16;
+    unsigned long c32, x;
+    unsigned char buf[12];
+    uint16_t y;
+    int i, n;
+
+    /* The documented example of Marsaglia's paper.	*/
+    srandom32 (2463534242UL);
+    if (random32 () != 723471715UL)
+	exit (__LINE__);
+
+    y = 1;
+    srandom16 (1);
+    for (i = 0; i < 100; i++) {
+	y = ref16 (y);
+	if (random16 () != y)
+	    exit (__LINE__);
+    }
+
+    /* A zero state is replaced, not kept.	*/
+    c16 = 0;
+    if (random16_r (&c16) == 0 || c16 == 0)
+	exit (__LINE__);
+    c32 = 0;
+    if (random32_r (&c32) == 0 || c32 == 0)
+	exit (__LINE__);
+
+    c32 = 12345;
+    x = 12345;
+    for (i = 0; i < 100; i++) {
+	x = ref32 (x);
+	if (random32_r (&c32) != x || c32 != x)
+	    exit (__LINE__);
+    }
+
+    /* random_fill_r() returns the bytes of the same sequence.	*/
+    for (n = 0; n <= (int) sizeof (buf) - 1; n++) {
+	c32 = 777;
+	x = 777;
+	memset (buf, 0xee, sizeof (buf));
+	random_fill_r (buf, n, &c32);
+	for (i = 0; i < n; i++) {
+	    if (i % 4 == 0)
+		x = ref32 (x);
+	    if (buf[i] != (unsigned char) (x >> (8 * (i % 4))))
+		exit (__LINE__);
+	}
+	if (buf[n] != 0xee || c32 != x)
+	    exit (__LINE__);
+    }
+
+    /* random_fill() goes on with the sequence of random32().	*/
+    srandom32 (99);
+    random_fill (buf, 4);
+    x = random32 ();
+    if (x != ref32 (ref32 (99)))
+	exit (__LINE__);
+
+    return 0;
+}
+
+#endif
@@ -0,0 +1,103 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Test of memcpy(), memmove() and memset(), all lengths up to 90, both
+   the default and the -lc_fast versions.
+   $Id$	*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#define MAXLEN	90
+#define GUARD	4
+
+static unsigned char src[MAXLEN + 2 * GUARD];
+static unsigned char dst[MAXLEN + 2 * GUARD];
+
+static void fill (unsigned char *p, size_t n, unsigned char seed)
+{
+    while (n--)
+	*p++ = seed++ * 7 + 1;
+}
+
+int main ()
+{
+    size_t len, i;
+    int off;
+
+    for (len = 0; len <= MAXLEN; len++) {
+
+	/* memcpy	*/
+	fill (src, sizeof (src), len);
+	memset (dst, 0xaa, sizeof (dst));
+	if (memcpy (dst + GUARD, src + GUARD, len) != dst + GUARD)
+	    exit (__LINE__);
+	for (i = 0; i < sizeof (dst); i++) {
+	    if (i < GUARD || i >= GUARD + len) {
+		if (dst[i] != 0xaa)
+		    exit (__LINE__);
+	    } else if (dst[i] != src[i]) {
+		exit (__LINE__);
+	    }
+	}
+
+	/* memset	*/
+	fill (dst, sizeof (dst), 0);
+	fill (src, sizeof (src), 0);
+	if (memset (dst + GUARD, 0x55, len) != dst + GUARD)
+	    exit (__LINE__);
+	for (i = 0; i < sizeof (dst); i++) {
+	    if (i < GUARD || i >= GUARD + len) {
+		if (dst[i] != src[i])
+		    exit (__LINE__);
+	    } else if (dst[i] != 0x55) {
+		exit (__LINE__);
+	    }
+	}
+
+	/* memmove, overlapped both ways	*/
+	for (off = -GUARD; off <= GUARD; off++) {
+	    size_t from = GUARD;
+	    size_t to = GUARD + off;
+	    if (len + GUARD > MAXLEN)
+		break;
+	    fill (dst, sizeof (dst), len);
+	    fill (src, sizeof (src), len);
+	    if (memmove (dst + to, dst + from, len) != dst + to)
+		exit (__LINE__);
+	    for (i = 0; i < sizeof (dst); i++) {
+		unsigned char c = (i >= to && i < to + len)
+				  ? src[i - to + from] : src[i];
+		if (dst[i] != c)
+		    exit (__LINE__);
+	    }
+	}
+    }
+    return 0;
+}
@@ -0,0 +1,111 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Test of strspn() family with sets, long enough to use a bitmap.
+   $Id$	*/
+
+#ifndef __AVR__
+# include <stdio.h>
+# define strspn_P	strspn
+# define strcspn_P	strcspn
+# define strpbrk_P	strpbrk
+# define strsep_P	strsep
+# define strtok_rP	strtok_r
+# define PROGMEM
+#else
+# include <avr/pgmspace.h>
+#endif
+#include <stdlib.h>
+#include <string.h>
+
+/* Characters with the same low 5 bits share a byte of the map.	*/
+static const char set_ram[] = "\001!Aa\201\241\301\341 ,;:";
+static const char set_pgm[] PROGMEM = "\001!Aa\201\241\301\341 ,;:";
+
+/* Twins of set[] members: the same low 5 bits, but not in set[].	*/
+static const char twins[] = "\002\"Bb\202\242\302\342@LMN";
+
+static char s[64];
+
+int main ()
+{
+    char *p, *q, *last;
+
+    /* strspn: all members are accepted, any twin stops the scan.	*/
+    strcpy (s, set_ram);
+    strcat (s, twins);
+    if (strspn (s, set_ram) != sizeof (set_ram) - 1)
+	exit (__LINE__);
+    if (strspn_P (s, set_pgm) != sizeof (set_ram) - 1)
+	exit (__LINE__);
+    if (strspn (s + 3, set_ram) != sizeof (set_ram) - 4)
+	exit (__LINE__);
+
+    /* strcspn: no twin is rejected, the first member stops the scan.	*/
+    strcpy (s, twins);
+    strcat (s, "\341x");
+    if (strcspn (s, set_ram) != sizeof (twins) - 1)
+	exit (__LINE__);
+    if (strcspn_P (s, set_pgm) != sizeof (twins) - 1)
+	exit (__LINE__);
+    if (strcspn (twins, set_ram) != sizeof (twins) - 1)
+	exit (__LINE__);
+
+    /* strpbrk	*/
+    if (strpbrk (twins, set_ram) != 0 || strpbrk_P (twins, set_pgm) != 0)
+	exit (__LINE__);
+    if (strpbrk (s, set_ram) != s + sizeof (twins) - 1)
+	exit (__LINE__);
+    if (strpbrk_P (s, set_pgm) != s + sizeof (twins) - 1)
+	exit (__LINE__);
+
+    /* strsep	*/
+    strcpy (s, "xy;zw");
+    p = s;
+    if (strsep (&p, set_ram) != s || p != s + 3 || s[2])
+	exit (__LINE__);
+    if (strsep_P (&p, set_pgm) != s + 3 || p)
+	exit (__LINE__);
+
+    /* strtok_r	*/
+    strcpy (s, ", ;bcd :e;f,,");
+    q = strtok_r (s, set_ram, &last);
+    if (q != s + 3 || strcmp (q, "bcd"))
+	exit (__LINE__);
+    q = strtok_rP (0, set_pgm, &last);
+    if (q != s + 8 || strcmp (q, "e"))
+	exit (__LINE__);
+    q = strtok_r (0, set_ram, &last);
+    if (q != s + 10 || strcmp (q, "f"))
+	exit (__LINE__);
+    if (strtok_rP (0, set_pgm, &last) || strtok_r (0, set_ram, &last))
+	exit (__LINE__);
+
+    return 0;
+}
@@ -0,0 +1,150 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Test of strstr(), memmem(), strcasestr() and their _P variants with
+   long needles and haystacks (the skip table search).
+   $Id$	*/
+
+#ifndef __AVR__
+# define _GNU_SOURCE	/* to include memmem(), strcasestr()	*/
+# define memmem_P	memmem
+# define strcasestr_P	strcasestr
+# define strstr_P	strstr
+#endif
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+#include "progmem.h"
+
+#define HLEN	300
+
+static char hay[HLEN + 1];
+static char ndl[40];
+
+/* Reference search.	*/
+static const char *
+find (const char *h, size_t hlen, const char *n, size_t nlen, int nocase)
+{
+    size_t i, j;
+
+    for (i = 0; i + nlen <= hlen; i++) {
+	for (j = 0; j < nlen; j++) {
+	    if (nocase ? tolower (h[i + j]) != tolower (n[j])
+		       : h[i + j] != n[j])
+		break;
+	}
+	if (j == nlen)
+	    return h + i;
+    }
+    return 0;
+}
+
+static void fill (const char *abc, unsigned int seed)
+{
+    int i, n = strlen (abc);
+
+    for (i = 0; i < HLEN; i++) {
+	seed = seed * 25173 + 13849;
+	hay[i] = abc[(seed >> 8) % n];
+    }
+    hay[HLEN] = 0;
+}
+
+static void check_ram (void)
+{
+    size_t k, len;
+
+    for (k = 0; k < HLEN; k += 13) {
+	/* Needle is a tail of haystack: up to 300 bytes.	*/
+	if (strstr (hay, hay + k) != find (hay, HLEN, hay + k, HLEN - k, 0))
+	    exit (__LINE__);
+	if (strcasestr (hay, hay + k)
+	    != find (hay, HLEN, hay + k, HLEN - k, 1))
+	    exit (__LINE__);
+
+	/* Needle inside haystack, all lengths up to 38.	*/
+	for (len = 0; len < sizeof (ndl) - 1 && k + len <= HLEN; len++) {
+	    size_t i;
+	    if (memmem (hay, HLEN, hay + k, len)
+		!= find (hay, HLEN, hay + k, len, 0))
+		exit (__LINE__);
+	    if (memmem (hay, k + len - 1, hay + k, len)
+		!= find (hay, k + len - 1, hay + k, len, 0))
+		exit (__LINE__);
+	    for (i = 0; i < len; i++)
+		ndl[i] = hay[k + i] ^ (isalpha (hay[k + i]) ? 0x20 : 0);
+	    ndl[len] = 0;
+	    if (strstr (hay, ndl) != find (hay, HLEN, ndl, len, 0))
+		exit (__LINE__);
+	    if (strcasestr (hay, ndl) != find (hay, HLEN, ndl, len, 1))
+		exit (__LINE__);
+	}
+    }
+}
+
+#define CHECK_P(s, expect)	do {				\
+    const char *__n = PSTR (s);					\
+    const char *__p;						\
+    __p = strstr_P (hay, __n);					\
+    if (__p != (expect < 0 ? 0 : hay + expect))			\
+	exit (__LINE__);					\
+    __p = memmem_P (hay, strlen (hay), __n, sizeof (s) - 1);	\
+    if (__p != (expect < 0 ? 0 : hay + expect))			\
+	exit (__LINE__);					\
+    __p = strcasestr_P (hay, __n);				\
+    if (__p != (expect < 0 ? 0 : hay + expect))			\
+	exit (__LINE__);					\
+  } while (0)
+
+int main ()
+{
+    fill ("ab", 1);
+    check_ram ();
+    fill ("aAbB", 2);
+    check_ram ();
+    fill ("a!A` \r\n", 3);
+    check_ram ();
+
+    strcpy_P (hay, PSTR ("HTTP/1.1 200 OK\r\n"
+			 "Server: Apache\r\n"
+			 "Content-Type: text/html; charset=UTF-8\r\n"
+			 "Content-Length: 88\r\n"
+			 "\r\n"
+			 "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"));
+    CHECK_P ("Content-Length:", 73);
+    CHECK_P ("\r\n\r\n", 91);
+    CHECK_P ("charset=UTF-8\r\n", 58);
+    CHECK_P ("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa", 95);
+    CHECK_P ("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa", -1);
+    CHECK_P ("+CME ERROR: 30", -1);
+    CHECK_P ("88\r\n\r\naaaaaaaa", 89);
+
+    return 0;
+}
@@ -0,0 +1,67 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE. */
+
+/* $Id$ */
+
+/*
+    This tests clock_tick(), clock_ms() and clock_ticks64(), with carries
+    across all bytes of the count.
+*/
+#include <time.h>
+
+extern volatile uint64_t __clock_ticks;
+
+int main(){
+uint32_t ms;
+uint64_t t;
+int i;
+
+    if (clock_ms() != 0 || clock_ticks64() != 0) return (__LINE__);
+
+    for (i = 1; i <= 1000; i++) {
+        clock_tick();
+        if (clock_ms() != (uint32_t)i) return (__LINE__);
+    }
+    if (clock_ticks64() != 1000) return (__LINE__);
+
+    __clock_ticks = 0xffffffffUL;
+    clock_tick();
+    ms = clock_ms();
+    t = clock_ticks64();
+    if (ms != 0 || t != 0x100000000ULL) return (__LINE__);
+
+    __clock_ticks = 0x00fffffffffffffeULL;
+    clock_tick();
+    if (clock_ticks64() != 0x00ffffffffffffffULL) return (__LINE__);
+    clock_tick();
+    if (clock_ticks64() != 0x0100000000000000ULL) return (__LINE__);
+    if (clock_ms() != 0) return (__LINE__);
+
+    return 0;
+
+}
@@ -0,0 +1,77 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE. */
+
+/* $Id$ */
+
+/*
+    This tests that ephemeris_r() agrees with the individual functions at
+    noon UTC, and recomputes when the day or the position changes.
+*/
+#include <string.h>
+#include <time.h>
+
+static struct ephemeris eph;
+
+static int check(time_t t)
+{
+    time_t noon;
+
+    ephemeris_r(&t, &eph);
+    noon = t - t % ONE_DAY + 43200L;
+    if (eph.declination != solar_declination(&noon)) return 1;
+    if (eph.equation != equation_of_time(&noon)) return 1;
+    if (eph.daylight != daylight_seconds(&noon)) return 1;
+    if (eph.noon != solar_noon(&noon)) return 1;
+    if (eph.rise != sun_rise(&noon)) return 1;
+    if (eph.set != sun_set(&noon)) return 1;
+    return 0;
+}
+
+int main(){
+time_t t;
+
+    /* New York City */
+    set_position(40.7142 * ONE_DEGREE, -74.0064 * ONE_DEGREE);
+    for (t = 0; t < 0xf0000000; t += 499 * ONE_DAY + 12345)
+        if (check(t)) return (__LINE__);
+
+    /* the same day: nothing changes */
+    t = 512355600UL;
+    if (check(t)) return (__LINE__);
+    memset(&eph.declination, 0, sizeof(eph.declination));
+    ephemeris_r(&t, &eph);
+    if (eph.declination != 0) return (__LINE__);
+
+    /* a new position, and a new day */
+    set_position(-33.8675 * ONE_DEGREE, 151.207 * ONE_DEGREE);
+    if (check(t)) return (__LINE__);
+    if (check(t + ONE_DAY)) return (__LINE__);
+
+    return 0;
+
+}
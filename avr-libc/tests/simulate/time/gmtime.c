@@ -0,0 +1,95 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE. */
+
+/* $Id$ */
+
+/*
+    This tests gmtime() and mk_gmtime() against known dates, around leap
+    days and the non-leap year 2100, and mk_gmtime() with days out of
+    the range of the month.
+*/
+#include <time.h>
+
+static const struct {
+    time_t          t;
+    int             year, mon, mday, yday, wday;
+} dates[] = {
+    { 0UL,           100,  0,  1,   0, SATURDAY },
+    { 5011200UL,     100,  1, 28,  58, MONDAY },
+    { 5097600UL,     100,  1, 29,  59, TUESDAY },
+    { 5184000UL,     100,  2,  1,  60, WEDNESDAY },
+    { 31536000UL,    100, 11, 31, 365, SUNDAY },
+    { 36633600UL,    101,  1, 28,  58, WEDNESDAY },
+    { 36720000UL,    101,  2,  1,  59, THURSDAY },
+    { 3155760000UL,  200,  0,  1,   0, FRIDAY },
+    { 3160684800UL,  200,  1, 27,  57, SATURDAY },
+    { 3160771200UL,  200,  1, 28,  58, SUNDAY },
+    { 3160857600UL,  200,  2,  1,  59, MONDAY },
+    { 3187209600UL,  200, 11, 31, 364, FRIDAY },
+    { 4294944000UL,  236,  1,  7,  37, TUESDAY },
+};
+
+/* Not normalized days across the end of February, 2100.   */
+static const struct {
+    time_t          t;
+    int             mon, mday;
+} days_2100[] = {
+    { 3160857600UL,  1, 29 },   /* March 1st        */
+    { 3160944000UL,  1, 30 },   /* March 2nd        */
+    { 3160771200UL,  2,  0 },   /* February 28th    */
+    { 3160684800UL,  2, -1 },   /* February 27th    */
+};
+
+int main(){
+struct tm *tm;
+time_t t;
+unsigned char i;
+
+    for (i = 0; i < sizeof(dates) / sizeof(dates[0]); i++) {
+        t = dates[i].t + 12345;
+        tm = gmtime(&t);
+        if (tm->tm_year != dates[i].year) return (__LINE__);
+        if (tm->tm_mon != dates[i].mon) return (__LINE__);
+        if (tm->tm_mday != dates[i].mday) return (__LINE__);
+        if (tm->tm_yday != dates[i].yday) return (__LINE__);
+        if (tm->tm_wday != dates[i].wday) return (__LINE__);
+        if (tm->tm_hour != 3 || tm->tm_min != 25 || tm->tm_sec != 45) return (__LINE__);
+        if (mk_gmtime(tm) != t) return (__LINE__);
+    }
+
+    for (i = 0; i < sizeof(days_2100) / sizeof(days_2100[0]); i++) {
+        tm->tm_year = 200;
+        tm->tm_mon = days_2100[i].mon;
+        tm->tm_mday = days_2100[i].mday;
+        tm->tm_hour = tm->tm_min = tm->tm_sec = 0;
+        if (mk_gmtime(tm) != days_2100[i].t) return (__LINE__);
+    }
+
+    return 0;
+
+}
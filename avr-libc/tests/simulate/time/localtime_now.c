@@ -0,0 +1,80 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE. */
+
+/* $Id$ */
+
+/*
+    This tests that localtime_now() follows system_tick() across minutes,
+    hours, days, months and years, and across Daylight Saving changes.
+*/
+#include <string.h>
+#include <time.h>
+#include <util/eu_dst.h>
+
+static const time_t start[] = {
+    86399UL - 3600,             /* 2000-01-01 23:59:59 local */
+    5183999UL - 3600,           /* 2000-02-29 23:59:59 */
+    36719999UL - 3600,          /* 2001-02-28 23:59:59 */
+    31622399UL - 3600,          /* 2000-12-31 23:59:59 */
+    3160857599UL - 3600,        /* 2100-02-28 23:59:59 */
+    512355599UL,                /* 2016-03-27 00:59:59 UTC, EU summer time */
+    531104399UL,                /* 2016-10-30 00:59:59 UTC, EU winter time */
+};
+
+static int check(void)
+{
+    struct tm now;
+    time_t t;
+
+    now = *localtime_now();
+    t = time(0);
+    if (memcmp(&now, localtime(&t), sizeof(now))) return 1;
+    return 0;
+}
+
+int main(){
+unsigned char i, n;
+
+    set_zone(ONE_HOUR);
+    for (i = 0; i < sizeof(start) / sizeof(start[0]); i++) {
+        if (i == 5)
+            set_dst(eu_dst);
+        set_system_time(start[i] - 2);
+        for (n = 0; n < 6; n++) {
+            if (check()) return (__LINE__);
+            system_tick();
+        }
+    }
+
+    /* changing the zone takes effect at once */
+    set_zone(-5 * ONE_HOUR);
+    if (check()) return (__LINE__);
+
+    return 0;
+
+}
@@ -0,0 +1,116 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE. */
+
+/* $Id$ */
+
+/*
+    This tests rule_dst() at the transitions of a year, for rules in both
+    hemispheres, the cache when the time jumps or the zone changes, and
+    the ends of time_t.
+*/
+#include <time.h>
+
+static const struct dst_rules cet = {
+    { MARCH, 5, SUNDAY, 2 }, { OCTOBER, 5, SUNDAY, 2 }, ONE_HOUR
+};
+
+static const struct dst_rules usa = {
+    { MARCH, 2, SUNDAY, 2 }, { NOVEMBER, 1, SUNDAY, 1 }, ONE_HOUR
+};
+
+static const struct dst_rules aus = {
+    { OCTOBER, 1, SUNDAY, 2 }, { APRIL, 1, SUNDAY, 2 }, ONE_HOUR
+};
+
+static const struct dst_rules bra = {
+    { OCTOBER, 3, SUNDAY, 0 }, { FEBRUARY, 1, SUNDAY, 0 }, ONE_HOUR
+};
+
+/* starts at the first second of 2000, local time: before the epoch in UTC+1 */
+static const struct dst_rules jan = {
+    { JANUARY, 1, SATURDAY, 0 }, { JUNE, 1, SUNDAY, 0 }, ONE_HOUR
+};
+
+/* the first second of Daylight Saving, and the first second after */
+static const struct {
+    const struct dst_rules *rules;
+    int32_t         zone;
+    time_t          start, end;
+} cases[] = {
+    { &cet, 1 * ONE_HOUR, 512355600UL, 531104400UL },   /* 2016 */
+    { &usa, -5 * ONE_HOUR, 542617200UL, 563176800UL },  /* 2017 */
+    { &aus, 10 * ONE_HOUR, 528652800UL, 512928000UL },  /* 2016 */
+};
+
+static int dst(time_t t, int32_t z)
+{
+    return rule_dst(&t, &z);
+}
+
+int main(){
+unsigned char i;
+int32_t z;
+time_t b, e;
+
+    for (i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        set_dst_rules(cases[i].rules);
+        z = cases[i].zone;
+        b = cases[i].start;
+        e = cases[i].end;
+
+        if (dst(b - 30L * ONE_DAY, z) != 0) return (__LINE__);
+        if (dst(b - 1, z) != 0) return (__LINE__);
+        if (dst(b, z) != ONE_HOUR) return (__LINE__);
+        if (dst(e - 1, z) != ONE_HOUR) return (__LINE__);
+        if (dst(e, z) != 0) return (__LINE__);
+        if (dst(b - 1, z) != 0) return (__LINE__);
+        if (dst(e + 30L * ONE_DAY, z) != 0) return (__LINE__);
+
+        /* an hour further West, the transitions are an hour later */
+        if (dst(b, z - ONE_HOUR) != 0) return (__LINE__);
+        if (dst(b + ONE_HOUR, z - ONE_HOUR) != ONE_HOUR) return (__LINE__);
+    }
+
+    /* the ends of time_t */
+    set_dst_rules(&cet);
+    if (dst(0, ONE_HOUR) != 0) return (__LINE__);
+    if (dst(0xffffffff, ONE_HOUR) != 0) return (__LINE__);
+
+    /* before the epoch in local time, then the middle of 2016 */
+    set_dst_rules(&bra);
+    if (dst(0, -3 * ONE_HOUR) != ONE_HOUR) return (__LINE__);
+    if (dst(520689600UL, -3 * ONE_HOUR) != 0) return (__LINE__);
+
+    /* a transition before the epoch has already happened */
+    set_dst_rules(&jan);
+    if (dst(0, ONE_HOUR) != ONE_HOUR) return (__LINE__);
+    if (dst(520689600UL, ONE_HOUR) != 0) return (__LINE__);
+
+    return 0;
+
+}
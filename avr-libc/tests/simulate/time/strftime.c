@@ -0,0 +1,97 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE. */
+
+/* $Id$ */
+
+/*
+    Conversions of strftime(), strftime_P() and fstrftime(), and the
+    behaviour of strftime() when the buffer is too small.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <avr/pgmspace.h>
+
+static const char fields[] = "%a %A %b %B %C %d %D %e %F %g %G %H %I %j %m %M %p %r %R %S %T %u %U %V %w %W %y %Y %z %%";
+static const char expect[] = "Thu Thursday Jul July 20 04 07/04/13  4 2013-07-04 13 2013 15 03 185 07 04 PM  3:04:05 PM 15:04 05 15:04:05 4 26 27 4 26 13 2013 +0000 %";
+
+static char     out[160];
+static uint8_t  pos;
+
+static int
+put(char c, FILE * fp)
+{
+	out[pos++] = c;
+	return 0;
+}
+
+static FILE     outfile = FDEV_SETUP_STREAM(put, 0, _FDEV_SETUP_WRITE);
+
+int
+main()
+{
+	time_t          t;
+	struct tm       tm;
+	char            buf[160];
+
+	t = 426265445;		/* 2013-07-04 15:04:05 */
+	gmtime_r(&t, &tm);
+
+	if (strftime(buf, sizeof(buf), fields, &tm) != strlen(expect)) return (__LINE__);
+	if (strcmp(buf, expect)) return (__LINE__);
+
+	if (strftime(buf, sizeof(buf), "%c", &tm) != 24) return (__LINE__);
+	if (strcmp(buf, "Thu Jul 04 15:04:05 2013")) return (__LINE__);
+
+	memset(buf, 0, sizeof(buf));
+	if (strftime_P(buf, sizeof(buf), PSTR("[%Y-%m-%d %H:%M:%S]"), &tm) != 21) return (__LINE__);
+	if (strcmp(buf, "[2013-07-04 15:04:05]")) return (__LINE__);
+
+	if (fstrftime(&outfile, fields, &tm) != strlen(expect)) return (__LINE__);
+	if (pos != strlen(expect) || memcmp(out, expect, pos)) return (__LINE__);
+
+	/* no room for the field and the nul: the result is 0, the text stops before the field */
+	memset(buf, 'x', sizeof(buf));
+	if (strftime(buf, 10, "%F", &tm) != 0) return (__LINE__);
+	if (buf[0] != 0 || buf[10] != 'x') return (__LINE__);
+	if (strftime(buf, 11, "ab %A", &tm) != 0) return (__LINE__);
+	if (strcmp(buf, "ab ") || buf[11] != 'x') return (__LINE__);
+	memset(buf, 'x', sizeof(buf));
+	if (strftime(buf, 3, "abc", &tm) != 0) return (__LINE__);
+	if (strcmp(buf, "ab") || buf[3] != 'x') return (__LINE__);
+	if (strftime(buf, 0, "abc", &tm) != 0) return (__LINE__);
+	if (buf[0] != 'a') return (__LINE__);
+	if (strftime(buf, 11, "%F", &tm) != 10) return (__LINE__);
+
+	/* unknown conversions, a trailing % */
+	if (strftime(buf, sizeof(buf), "%Q%", &tm) != 1) return (__LINE__);
+	if (strcmp(buf, "?")) return (__LINE__);
+
+	return 0;
+}
@@ -0,0 +1,101 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE. */
+
+/* $Id$ */
+
+/*
+    This tests timer_start(), timer_stop() and timer_tick(): expiry at the
+    right tick across turns of the wheel, stopping, restarting, and
+    callbacks which start and stop timers.
+*/
+#include <stdlib.h>
+#include <util/timer.h>
+
+#define N   8
+
+static struct timer timers[N];
+static uint16_t fired[N];
+static uint16_t now;
+static struct timer periodic;
+static uint8_t periodic_count;
+
+static void expire(struct timer *t)
+{
+    uint8_t i = t - timers;
+
+    if (fired[i]) exit(__LINE__);
+    fired[i] = now;
+
+    /* the expiry of timer 0 stops timer 1, due at the same tick */
+    if (i == 0)
+        timer_stop(&timers[1]);
+}
+
+static void repeat(struct timer *t)
+{
+    if (++periodic_count < 5)
+        timer_start(t, 7, repeat);
+}
+
+static const uint16_t delay[N] = { 100, 100, 1, 0, 31, 32, 33, 500 };
+
+int main(){
+uint8_t i;
+
+    for (i = 0; i < N; i++)
+        timer_start(&timers[i], delay[i], expire);
+    timer_start(&periodic, 3, repeat);
+
+    /* stopped, and restarted later */
+    timer_stop(&timers[6]);
+    timer_stop(&timers[6]);
+
+    for (now = 1; now <= 600; now++) {
+        if (now == 10)
+            timer_start(&timers[6], 33, expire);    /* at 42 */
+        if (now == 20)
+            timer_start(&timers[7], 64, expire);    /* at 83, not 500 */
+        timer_tick();
+    }
+
+    if (fired[0] != 100) return (__LINE__);
+    if (fired[1] != 0) return (__LINE__);
+    if (fired[2] != 1) return (__LINE__);
+    if (fired[3] != 1) return (__LINE__);
+    if (fired[4] != 31) return (__LINE__);
+    if (fired[5] != 32) return (__LINE__);
+    if (fired[6] != 42) return (__LINE__);
+    if (fired[7] != 83) return (__LINE__);
+    if (periodic_count != 5) return (__LINE__);
+
+    for (i = 0; i < N; i++)
+        if (timers[i].pprev) return (__LINE__);
+
+    return 0;
+
+}
@@ -0,0 +1,129 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Test of <util/divmod.h>: division by constants.
+   $Id$	*/
+
+#ifndef __AVR__
+
+/* Omit the test.	*/
+int main ()	{ return 0; }
+
+#else
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <util/divmod.h>
+
+static volatile uint8_t  v8;
+static volatile uint16_t v16;
+static volatile uint32_t v32;
+
+/* Check one divisor over a spread of dividends, including the edges.	*/
+#define CHECK8(d)	do {					\
+    uint16_t __i;						\
+    for (__i = 0; __i < 256; __i++) {				\
+	udiv8_t __r;						\
+	v8 = __i;						\
+	__r = udivmod8_const (v8, d);				\
+	if (__r.quot != (uint8_t)__i / (d)			\
+	    || __r.rem != (uint8_t)__i % (d))			\
+	    exit (__LINE__);					\
+    }								\
+  } while (0)
+
+#define CHECK16(d)	do {					\
+    uint32_t __i;						\
+    for (__i = 0; __i < 0x10000; __i += 97) {			\
+	udiv16_t __r;						\
+	v16 = __i;						\
+	__r = udivmod16_const (v16, d);				\
+	if (__r.quot != (uint16_t)__i / (d)			\
+	    || __r.rem != (uint16_t)__i % (d))			\
+	    exit (__LINE__);					\
+    }								\
+    v16 = 0xffff;						\
+    if (udivmod16_const (v16, d).quot != 0xffffU / (d))	\
+	exit (__LINE__);					\
+  } while (0)
+
+#define CHECK32(d)	do {					\
+    uint32_t __i, __x = 1;					\
+    for (__i = 0; __i < 200; __i++) {				\
+	udiv32_t __r;						\
+	__x = __x * 1664525 + 1013904223;			\
+	v32 = __x;						\
+	__r = udivmod32_const (v32, d);				\
+	if (__r.quot != __x / (d) || __r.rem != __x % (d))	\
+	    exit (__LINE__);					\
+    }								\
+    v32 = 0xffffffff;						\
+    if (udivmod32_const (v32, d).quot != 0xffffffffUL / (d))	\
+	exit (__LINE__);					\
+  } while (0)
+
+int main ()
+{
+    CHECK8 (2);
+    CHECK8 (3);
+    CHECK8 (7);
+    CHECK8 (10);
+    CHECK8 (60);
+    CHECK8 (100);
+    CHECK8 (255);
+
+    CHECK16 (2);
+    CHECK16 (7);
+    CHECK16 (10);
+    CHECK16 (60);
+    CHECK16 (365);
+    CHECK16 (1461);
+    CHECK16 (36525);
+    CHECK16 (65535);
+
+    CHECK32 (3);
+    CHECK32 (10);
+    CHECK32 (60);
+    CHECK32 (3600);
+    CHECK32 (86400);
+    CHECK32 (4194303);
+
+    /* Named shorthands.	*/
+    v16 = 12345;
+    if (udivmod16_10 (v16).quot != 1234 || udivmod16_10 (v16).rem != 5)
+	exit (__LINE__);
+    v32 = 1000000000;
+    if (udivmod32_86400 (v32).quot != 11574
+	|| udivmod32_86400 (v32).rem != 6400)
+	exit (__LINE__);
+
+    return 0;
+}
+
+#endif	/* __AVR__ */
@@ -0,0 +1,133 @@
+/* Copyright (c) 2026
+   All rights reserved.
+
+   Redistribution and use in source and binary forms, with or without
+   modification, are permitted provided that the following conditions are met:
+
+   * Redistributions of source code must retain the above copyright
+     notice, this list of conditions and the following disclaimer.
+   * Redistributions in binary form must reproduce the above copyright
+     notice, this list of conditions and the following disclaimer in
+     the documentation and/or other materials provided with the
+     distribution.
+   * Neither the name of the copyright holders nor the names of
+     contributors may be used to endorse or promote products derived
+     from this software without specific prior written permission.
+
+   THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+   AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+   IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+   ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+   LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+   CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+   SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+   INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+   CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+   ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+   POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Test of <util/sort.h>: type-specific sort and search.
+   $Id$	*/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <util/sort.h>
+
+struct pair {
+    uint8_t key;
+    uint8_t val;
+};
+
+#define less_i16(a, b)	((a) < (b))
+#define less_u32(a, b)	((a) < (b))
+#define less_key(a, b)	((a).key < (b).key)
+
+SORT_DEFINE (sort_i16, int16_t, less_i16)
+SORT_DEFINE (sort_u32, uint32_t, less_u32)
+SORT_DEFINE (sort_pair, struct pair, less_key)
+BSEARCH_DEFINE (find_i16, int16_t, less_i16)
+BSEARCH_DEFINE (find_pair, struct pair, less_key)
+
+#define N	50
+
+static union {
+    int16_t i16[N];
+    uint32_t u32[N];
+    struct pair pair[N];
+} u;
+
+static int16_t value (int order, int i)
+{
+    switch (order) {
+	case 0:  return rand ();
+	case 1:  return i - 20;
+	case 2:  return 1000 - 7 * i;
+	case 3:  return -3;
+	case 4:  return (rand () & 3) - 2;
+	default: return i < N / 2 ? i : N - i;
+    }
+}
+
+int main ()
+{
+    int order, n, i;
+    int32_t sum;
+    struct pair key;
+
+    for (order = 0; order < 6; order++) {
+	for (n = 0; n <= N; n++) {
+	    sum = 0;
+	    for (i = 0; i < n; i++)
+		sum += u.i16[i] = value (order, i);
+	    sort_i16 (u.i16, n);
+	    for (i = 0; i < n; i++) {
+		if (i && u.i16[i - 1] > u.i16[i])
+		    exit (__LINE__);
+		sum -= u.i16[i];
+	    }
+	    if (sum)
+		exit (__LINE__);
+	}
+
+	for (i = 0; i < N; i++)
+	    u.u32[i] = (uint32_t) value (order, i) << 17 | i;
+	sort_u32 (u.u32, N);
+	for (i = 1; i < N; i++)
+	    if (u.u32[i - 1] >= u.u32[i])
+		exit (__LINE__);
+    }
+
+    /* The payload moves with its key.	*/
+    for (i = 0; i < N; i++) {
+	u.pair[i].key = 37 * i % N;
+	u.pair[i].val = ~u.pair[i].key;
+    }
+    sort_pair (u.pair, N);
+    for (i = 0; i < N; i++)
+	if (u.pair[i].key != i || u.pair[i].val != (uint8_t) ~i)
+	    exit (__LINE__);
+    key.key = 17;
+    if (find_pair (key, u.pair, N) != u.pair + 17)
+	exit (__LINE__);
+    key.key = N;
+    if (find_pair (key, u.pair, N))
+	exit (__LINE__);
+
+    /* The first one of equal keys is found.	*/
+    for (i = 0; i < 20; i++)
+	u.i16[i] = 2 * (i / 3);
+    for (i = -1; i < 16; i++) {
+	int16_t *p = find_i16 (i, u.i16, 20);
+	if (i < 0 || i > 12 || (i & 1)) {
+	    if (p)
+		exit (__LINE__);
+	} else if (p != u.i16 + (i / 2) * 3) {
+	    exit (__LINE__);
+	}
+    }
+    if (find_i16 (0, u.i16, 0))
+	exit (__LINE__);
+
+    return 0;
+}